@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace hakoniwa::api {
+
+/**
+ * @brief Wakeup signal that cuts a timed sleep short.
+ *
+ * ServerCore::stop() notifies it so that the serve thread does not sleep out
+ * an adaptive-mode backoff, and ClientCore::submit() and stop() notify it so
+ * that the client I/O thread sends a new call or exits without waiting out
+ * its poll interval. A notify() that comes before wait_for() stays pending,
+ * so the wakeup is not lost.
+ */
+class ArrivalNotifier {
+public:
+    void notify() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            pending_++;
+        }
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief Block until notified or timeout.
+     * @return true if woken by notify(), false on timeout.
+     */
+    bool wait_for(uint64_t timeout_usec) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        bool signaled = cv_.wait_for(lock, std::chrono::microseconds(timeout_usec),
+                                     [this] { return pending_ > 0; });
+        pending_ = 0;
+        return signaled;
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    uint64_t pending_{0};
+};
+
+} // namespace hakoniwa::api
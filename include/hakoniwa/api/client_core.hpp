@@ -1,14 +1,55 @@
 #pragma once
 
+#include "hakoniwa/api/arrival_notifier.hpp"
 #include "hakoniwa/api/protocol.hpp"
+#include "hakoniwa/api/service_stats.hpp"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
-#include <cstdint>
+#include <thread>
+#include <vector>
 #include "hakoniwa/pdu/rpc/rpc_service_helper.hpp"
 #include "hakoniwa/pdu/rpc/rpc_services_client.hpp" // Directly include for full definition
 
 namespace hakoniwa::api {
 
+/**
+ * @brief Outcome of an asynchronous call.
+ */
+struct CallStatus {
+  bool ok{false};
+  std::string error; // empty when ok
+};
+template <typename T> struct CallResult : CallStatus {
+  T value{};
+};
+template <typename Result> using Completion = std::function<void(const Result &)>;
+
+/**
+ * @brief Result of one sub-operation of a batch.
+ */
+struct BatchOpResult {
+  ServiceId op{ServiceId::Count};
+  int32_t result_code{0}; // HAKO_SERVICE_RESULT_CODE_*
+  uint32_t value{0};      // GetSimState: sim_state, GetEvent: event code
+};
+struct BatchReply {
+  std::vector<BatchOpResult> results; // in the order the operations were added
+  // state reported by the last successful GetSimState operation, if any
+  std::optional<HakoSimulationStateInfo> sim_state;
+};
+
+class BatchBuilder;
+class ClientMux;
+
 class ClientCore {
 public:
   /**
@@ -27,15 +68,68 @@ public:
    */
   bool initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container);
 
+  /**
+   * @brief Starts the RPC client services and the client I/O thread.
+   * All calls, synchronous or not, are sent and completed on that thread.
+   * A client created by ClientMux is started and stopped by the mux.
+   */
   bool start();
   bool is_pdu_end_point_running();
   bool stop();
 
+  const std::string &node_id() const noexcept { return node_id_; }
+  // participant name from the config; empty until initialize()
+  const std::string &client_name() const noexcept { return client_name_; }
+
+  /**
+   * @brief Timeout applied to each call made after this point; 0 waits forever.
+   * Defaults to the participant's call_timeout_usec. A timed-out call
+   * completes with an error.
+   */
+  void set_call_timeout_usec(uint64_t timeout_usec) noexcept { call_timeout_usec_ = timeout_usec; }
+  uint64_t call_timeout_usec() const noexcept { return call_timeout_usec_.load(); }
+
+  /**
+   * @brief Opt-in cache for get_sim_state(); 0 (default) disables it.
+   * Defaults to the participant's sim_state_cache_usec. A cached state is
+   * served for at most max_age_usec after it was received, without a round
+   * trip; while the simulation is running its master_time is extrapolated
+   * by the local steady clock, which assumes real-time pacing. The cache is
+   * dropped on any sim_control, ack_event or received event. get_sim_state()
+   * returns a cache hit on the calling thread; get_sim_state_async() still
+   * completes it on the client I/O thread.
+   */
+  void set_sim_state_cache_usec(uint64_t max_age_usec) noexcept { sim_state_cache_usec_ = max_age_usec; }
+  uint64_t sim_state_cache_usec() const noexcept { return sim_state_cache_usec_.load(); }
+  void invalidate_sim_state_cache();
+
+  /**
+   * @brief Automatic reconnect; 0 (default) disables it. Takes effect at start().
+   * Defaults to the participant's reconnect_max_backoff_usec. While started,
+   * the I/O thread checks the endpoint every 10 ms; when it is down, calls in
+   * flight fail with "Connection lost.", nothing is sent, and the I/O thread
+   * restarts the endpoint with an exponential backoff (10 ms, 20 ms, ... up
+   * to max_backoff_usec). Calls made meanwhile wait (or time out) and are sent
+   * once the endpoint is up again, after a re-join with the session token that
+   * resumes the server-side registration instead of registering anew.
+   * An event subscription ends with the lost call and must be renewed.
+   * Not available to ClientMux clients, whose endpoint is shared.
+   */
+  void set_reconnect_max_backoff_usec(uint64_t max_backoff_usec) noexcept {
+    reconnect_max_backoff_usec_ = max_backoff_usec;
+  }
+  uint64_t reconnect_max_backoff_usec() const noexcept { return reconnect_max_backoff_usec_.load(); }
+  uint64_t reconnect_count() const noexcept { return reconnect_count_.load(); }
+
   /**
    * @brief Joins the simulation.
+   * The first successful join starts a session; joining again with the
+   * session token it returned resumes that session (see reconnect).
    * @return true on success, false on failure.
    */
   bool join();
+  // token of the current Join session; 0 before the first successful join
+  uint64_t session_token() const noexcept { return session_token_.load(); }
 
   /**
    * @brief Get the current simulation state.
@@ -58,6 +152,15 @@ public:
    */
   bool get_event(HakoSimulationAssetEvent &event);
 
+  /**
+   * @brief Long-poll variant of get_event(): the server holds the request
+   * until an event other than None occurs or wait_timeout_msec passes.
+   * The call timeout, if any, is extended by wait_timeout_msec.
+   * @param[out] event The event code; None if the wait timed out.
+   * @return true on success, false on failure.
+   */
+  bool get_event(HakoSimulationAssetEvent &event, uint32_t wait_timeout_msec);
+
   /**
    * @brief Acknowledge that an event has been processed.
    * @param event The event that was processed.
@@ -65,6 +168,61 @@ public:
    */
   bool ack_event(HakoSimulationAssetEvent event);
 
+  /**
+   * @brief Get the server-side latency statistics of a service.
+   * @param service_name Full service name, e.g. "HakoRemoteApi/GetSimState".
+   * @param[out] stats Percentiles of queue wait, handler, reply and total time.
+   * @return true on success, false on failure.
+   */
+  bool get_server_stats(const std::string &service_name, ServiceStats &stats);
+
+  /**
+   * @brief Receive asset events pushed by the server instead of polling GetEvent.
+   * Keeps one HakoRemoteApi/SubscribeEvents request parked on the server,
+   * which answers it when an event other than None occurs (each event once)
+   * and re-arms it. on_event runs on the client I/O thread for every event;
+   * on an error it is called once with ok == false and the subscription ends.
+   * Subscribing again replaces the previous callback.
+   */
+  void subscribe_events(Completion<CallResult<HakoSimulationAssetEvent>> on_event);
+  /**
+   * @brief Stop re-arming the subscription. The request still parked on the
+   * server ends with the next event or the server's keepalive, and is not
+   * delivered. A subscribe_events() before then is sent once it has ended.
+   */
+  void unsubscribe_events();
+
+  /**
+   * @brief Start a batch: several operations sent as one Batch request and
+   * answered in one response. See BatchBuilder.
+   */
+  BatchBuilder batch();
+
+  /*
+   * Asynchronous variants. Each returns immediately; the result is delivered
+   * either through the returned future or to the completion callback, which
+   * runs on the client I/O thread and must not block or call the
+   * synchronous methods above. Calls to different services are in flight
+   * concurrently, but each service has at most one call outstanding: the RPC
+   * client keeps one pending request per service and does not return the
+   * request_id it assigns, so responses cannot be correlated by request_id.
+   * Further calls to the same service wait and are sent in submission order.
+   * Calls still pending at stop() complete with an error.
+   */
+  std::future<CallStatus> join_async();
+  void join_async(Completion<CallStatus> done);
+  std::future<CallResult<HakoSimulationStateInfo>> get_sim_state_async();
+  void get_sim_state_async(Completion<CallResult<HakoSimulationStateInfo>> done);
+  std::future<CallStatus> sim_control_async(HakoSimulationControlCommand command);
+  void sim_control_async(HakoSimulationControlCommand command, Completion<CallStatus> done);
+  std::future<CallResult<HakoSimulationAssetEvent>> get_event_async(uint32_t wait_timeout_msec = 0);
+  void get_event_async(Completion<CallResult<HakoSimulationAssetEvent>> done);
+  void get_event_async(uint32_t wait_timeout_msec, Completion<CallResult<HakoSimulationAssetEvent>> done);
+  std::future<CallStatus> ack_event_async(HakoSimulationAssetEvent event);
+  void ack_event_async(HakoSimulationAssetEvent event, Completion<CallStatus> done);
+  std::future<CallResult<ServiceStats>> get_server_stats_async(const std::string &service_name);
+  void get_server_stats_async(const std::string &service_name, Completion<CallResult<ServiceStats>> done);
+
   /**
    * @brief Get the last error message.
    * @return A string containing the last error message.
@@ -72,8 +230,63 @@ public:
   std::string last_error() const;
 
 private:
+    friend class BatchBuilder;
+    friend class ClientMux;
+    struct BatchOp {
+        ServiceId op;
+        uint32_t arg;
+    };
+    void batch_async(std::vector<BatchOp> ops, Completion<CallResult<BatchReply>> done);
+
+    static constexpr uint64_t kHoldIndefinitely = UINT64_MAX;
+    // Cap of the I/O thread's poll backoff while a response is outstanding.
+    // It is fixed rather than poll_sleep_time_usec: with no arrival signal
+    // from the RPC client, the cap is the worst-case response pickup delay.
+    static constexpr uint64_t kResponsePollMaxBackoffUsec = 100;
+    struct PendingCall {
+        ServiceId service_id{ServiceId::Count};
+        uint64_t timeout_usec{0};  // 0 = no timeout
+        uint64_t deadline_usec{0}; // steady_now_usec() based; 0 = none
+        // how long the server may park the request before answering; added to
+        // the call timeout. kHoldIndefinitely: the call never times out.
+        uint64_t hold_usec{0};
+        // Sends the request; runs on the I/O thread. Empty for a call that is
+        // only completed there (a GetSimState cache hit).
+        std::function<bool(hakoniwa::pdu::rpc::RpcServicesClient&, uint64_t)> send;
+        // Delivers the result; response is nullptr if the call failed without one.
+        std::function<void(hakoniwa::pdu::rpc::RpcResponse*, const std::string&)> complete;
+    };
+
     void set_last_error(const std::string &msg);
-    bool wait_response_for(const std::string& expected_service, hakoniwa::pdu::rpc::RpcResponse& out_resp);
+    bool finish(const CallStatus& status);
+    template <typename ServiceHelper, typename Result, typename Request, typename Decode>
+    void call_async(ServiceId service_id, Request request_body, Decode decode, Completion<Result> done,
+                    uint64_t hold_usec = 0);
+    void arm_event_subscription(uint64_t generation,
+                                std::shared_ptr<Completion<CallResult<HakoSimulationAssetEvent>>> on_event);
+    void submit(PendingCall call);
+    void start_io_thread();
+    void stop_io_thread();
+    void io_loop();
+    bool supervise_link(uint64_t now_usec);
+    bool restart_endpoint();
+    bool take_submitted_calls();
+    struct IoStep {
+        bool took_calls{false};       // new calls were submitted
+        bool responded{false};        // a response or RPC timeout completed a call
+        bool has_in_flight{false};    // a response is still outstanding
+        uint64_t until_deadline_usec{0}; // time to the next call deadline; 0 = none
+    };
+    IoStep io_step();
+    void fail_pending_calls(const std::string& error);
+    void fail_in_flight_calls(const std::string& error);
+    bool dispatch_waiting_calls();
+    uint64_t expire_calls(uint64_t now_usec);
+    bool cached_sim_state(HakoSimulationStateInfo& state);
+    uint64_t sim_state_cache_epoch();
+    void store_sim_state(const HakoSimulationStateInfo& state, uint64_t epoch);
+    void complete_in_flight(const std::string& service_name, hakoniwa::pdu::rpc::RpcResponse* response,
+                            const std::string& error);
     std::string node_id_;
     std::string client_name_;
     uint64_t poll_sleep_time_usec_{100000};
@@ -85,6 +298,88 @@ private:
     std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesClient> rpc_client_; // Corrected class name
     std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container_;
     bool is_initialized_ = false;
+
+    std::atomic<uint64_t> call_timeout_usec_{0};
+    std::atomic<uint64_t> sim_state_cache_usec_{0};
+    std::atomic<uint64_t> reconnect_max_backoff_usec_{0};
+    std::atomic<uint64_t> reconnect_count_{0};
+    std::atomic<uint64_t> session_token_{0};
+    // automatic reconnect; set by start(), the rest is I/O thread only
+    bool reconnect_enabled_{false};
+    bool link_down_{false};
+    bool endpoint_restarted_{false};
+    uint64_t next_link_check_usec_{0};
+    uint64_t next_restart_usec_{0};
+    uint64_t restart_backoff_usec_{0};
+    struct SimStateCache {
+        bool valid{false};
+        HakoSimulationStateInfo state{};
+        uint64_t received_usec{0}; // steady clock
+        uint64_t epoch{0};         // bumped by every invalidation
+    };
+    std::mutex sim_state_cache_mutex_;
+    SimStateCache sim_state_cache_; // guarded by sim_state_cache_mutex_
+    // bumped by subscribe/unsubscribe; a subscription chain stops once it is stale
+    std::atomic<uint64_t> subscription_generation_{0};
+    ArrivalNotifier arrival_notifier_;
+    // wakes whichever thread runs io_step(): arrival_notifier_, or the mux's
+    ArrivalNotifier* io_notifier_{&arrival_notifier_};
+    ClientMux* mux_{nullptr};
+    std::thread io_thread_;
+    std::mutex submit_mutex_;
+    std::condition_variable submit_cv_;
+    bool io_running_{false};               // guarded by submit_mutex_
+    std::deque<PendingCall> submitted_;    // guarded by submit_mutex_
+    // I/O thread only: calls taken from submitted_, calls waiting for their
+    // service, and the one in flight per service (at most kServiceCount per
+    // client; there is no request_id-keyed table, see the async methods)
+    std::deque<PendingCall> incoming_;
+    std::array<std::deque<PendingCall>, kServiceCount> waiting_;
+    std::array<std::optional<PendingCall>, kServiceCount> in_flight_;
+    // request_id of the last response accepted per service (I/O thread only)
+    std::array<std::optional<uint32_t>, kServiceCount> last_request_id_;
+};
+
+/**
+ * @brief Collects up to kBatchMaxOps operations for one Batch round trip.
+ *
+ *   BatchReply reply;
+ *   client.batch().get_event().ack_last_event().get_sim_state().send(reply);
+ *
+ * The server runs the operations in order and reports a result code for
+ * each; one failing does not stop the rest. send() fails only when the
+ * batch itself could not be delivered or answered.
+ */
+class BatchBuilder {
+public:
+  BatchBuilder &get_sim_state() { return add(ServiceId::GetSimState, 0); }
+  BatchBuilder &sim_control(HakoSimulationControlCommand command) {
+    return add(ServiceId::SimControl, static_cast<uint32_t>(command));
+  }
+  BatchBuilder &get_event() { return add(ServiceId::GetEvent, 0); }
+  BatchBuilder &ack_event(HakoSimulationAssetEvent event) {
+    return add(ServiceId::AckEvent, static_cast<uint32_t>(event));
+  }
+  // Acknowledge whatever the preceding get_event() of this batch returned;
+  // a no-op on the server when that was HakoSimAssetEvent_None.
+  BatchBuilder &ack_last_event() { return add(ServiceId::AckEvent, kBatchArgLastEvent); }
+
+  size_t size() const noexcept { return ops_.size(); }
+
+  bool send(BatchReply &reply);
+  std::future<CallResult<BatchReply>> send_async();
+  void send_async(Completion<CallResult<BatchReply>> done);
+
+private:
+  friend class ClientCore;
+  explicit BatchBuilder(ClientCore &client) : client_(&client) {}
+  BatchBuilder &add(ServiceId op, uint32_t arg) {
+    ops_.push_back({op, arg});
+    return *this;
+  }
+
+  ClientCore *client_;
+  std::vector<ClientCore::BatchOp> ops_;
 };
 
 } // namespace hakoniwa::api
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hakoniwa/api/client_core.hpp"
+
+namespace hakoniwa::api {
+
+template <typename T> class Task;
+
+/**
+ * @brief Single-threaded executor for ClientCore coroutines.
+ *
+ * Coroutines only ever resume on the thread that calls run(). RPC
+ * completions arrive on the ClientCore I/O thread and are posted here, so
+ * any number of logical sessions can share one thread without blocking.
+ */
+class ClientExecutor {
+public:
+    ClientExecutor() = default;
+    ClientExecutor(const ClientExecutor&) = delete;
+    ClientExecutor& operator=(const ClientExecutor&) = delete;
+
+    // Queue a coroutine for resumption; thread safe.
+    void post(std::coroutine_handle<> handle);
+    // Start a task. Call from the executor thread, or before run().
+    void spawn(Task<void> task);
+    // Resume queued coroutines until every spawned task has finished or stop() is called.
+    void run();
+    // Make run() return; thread safe.
+    void stop();
+
+    class SleepAwaiter {
+    public:
+        SleepAwaiter(ClientExecutor& executor, uint64_t duration_usec)
+            : executor_(executor), duration_usec_(duration_usec) {}
+        bool await_ready() const noexcept { return duration_usec_ == 0; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            executor_.add_timer(steady_now_usec() + duration_usec_, handle);
+        }
+        void await_resume() const noexcept {}
+    private:
+        ClientExecutor& executor_;
+        uint64_t duration_usec_;
+    };
+    // Suspend the calling coroutine without blocking the executor thread.
+    SleepAwaiter sleep_for(uint64_t duration_usec) { return SleepAwaiter(*this, duration_usec); }
+
+private:
+    struct Timer {
+        uint64_t deadline_usec;
+        std::coroutine_handle<> handle;
+        bool operator>(const Timer& other) const { return deadline_usec > other.deadline_usec; }
+    };
+    void add_timer(uint64_t deadline_usec, std::coroutine_handle<> handle);
+    void task_finished() { live_tasks_--; }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<std::coroutine_handle<>> ready_; // guarded by mtx_
+    bool stop_requested_{false};                // guarded by mtx_
+    // executor thread only
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers_;
+    size_t live_tasks_{0};
+
+    struct Detached;
+    static Detached run_detached(ClientExecutor& executor, Task<void> task);
+};
+
+namespace detail {
+
+template <typename T>
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            auto next = handle.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    // The API reports failures through CallStatus, not exceptions.
+    void unhandled_exception() noexcept { std::terminate(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase<T> {
+    std::optional<T> value;
+    Task<T> get_return_object() noexcept;
+    template <typename U>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase<void> {
+    Task<void> get_return_object() noexcept;
+    void return_void() noexcept {}
+};
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine. Runs when awaited (or spawned on a
+ * ClientExecutor) and resumes its awaiter when it finishes.
+ */
+template <typename T = void>
+class Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+    T await_resume() {
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(*handle_.promise().value);
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+/**
+ * @brief Awaitable for one ClientCore *_async call. The coroutine is
+ * resumed on the executor thread with the call's result.
+ */
+template <typename Result>
+class CallAwaiter {
+public:
+    using Start = std::function<void(Completion<Result>)>;
+
+    CallAwaiter(ClientExecutor& executor, Start start) : executor_(executor), start_(std::move(start)) {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) {
+        start_([this, handle](const Result& result) {
+            result_ = result;
+            executor_.post(handle);
+        });
+    }
+    Result await_resume() { return std::move(result_); }
+
+private:
+    ClientExecutor& executor_;
+    Start start_;
+    Result result_;
+};
+
+/**
+ * @brief Coroutine front end of a ClientCore.
+ *
+ *   Task<void> session(CoClient& client) {
+ *       auto state = co_await client.get_sim_state();
+ *       auto event = co_await client.wait_event();
+ *   }
+ */
+class CoClient {
+public:
+    CoClient(ClientCore& client, ClientExecutor& executor) : client_(client), executor_(executor) {}
+
+    CallAwaiter<CallStatus> join() {
+        return {executor_, [this](Completion<CallStatus> done) { client_.join_async(std::move(done)); }};
+    }
+    CallAwaiter<CallResult<HakoSimulationStateInfo>> get_sim_state() {
+        return {executor_, [this](Completion<CallResult<HakoSimulationStateInfo>> done) {
+                    client_.get_sim_state_async(std::move(done));
+                }};
+    }
+    CallAwaiter<CallStatus> sim_control(HakoSimulationControlCommand command) {
+        return {executor_, [this, command](Completion<CallStatus> done) {
+                    client_.sim_control_async(command, std::move(done));
+                }};
+    }
+    // wait_timeout_msec > 0: long poll, see ClientCore::get_event()
+    CallAwaiter<CallResult<HakoSimulationAssetEvent>> get_event(uint32_t wait_timeout_msec = 0) {
+        return {executor_, [this, wait_timeout_msec](Completion<CallResult<HakoSimulationAssetEvent>> done) {
+                    client_.get_event_async(wait_timeout_msec, std::move(done));
+                }};
+    }
+    CallAwaiter<CallStatus> ack_event(HakoSimulationAssetEvent event) {
+        return {executor_, [this, event](Completion<CallStatus> done) {
+                    client_.ack_event_async(event, std::move(done));
+                }};
+    }
+    CallAwaiter<CallResult<ServiceStats>> get_server_stats(std::string service_name) {
+        return {executor_, [this, service_name = std::move(service_name)](Completion<CallResult<ServiceStats>> done) {
+                    client_.get_server_stats_async(service_name, std::move(done));
+                }};
+    }
+    CallAwaiter<CallResult<BatchReply>> batch(BatchBuilder batch) {
+        return {executor_, [batch = std::move(batch)](Completion<CallResult<BatchReply>> done) mutable {
+                    batch.send_async(std::move(done));
+                }};
+    }
+
+    /**
+     * @brief Wait until an event other than None arrives or a call fails.
+     * Uses long-poll GetEvent calls of wait_timeout_msec each, so there is
+     * one outstanding request instead of a polling loop.
+     */
+    Task<CallResult<HakoSimulationAssetEvent>> wait_event(uint32_t wait_timeout_msec = 1000) {
+        for (;;) {
+            auto result = co_await get_event(wait_timeout_msec);
+            if (!result.ok || result.value != HakoSimulationAssetEvent::HakoSimAssetEvent_None) {
+                co_return result;
+            }
+        }
+    }
+
+    ClientCore& core() noexcept { return client_; }
+    ClientExecutor& executor() noexcept { return executor_; }
+
+private:
+    ClientCore& client_;
+    ClientExecutor& executor_;
+};
+
+} // namespace hakoniwa::api
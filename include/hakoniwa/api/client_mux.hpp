@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "hakoniwa/api/arrival_notifier.hpp"
+#include "hakoniwa/api/client_core.hpp"
+
+namespace hakoniwa::api {
+
+/**
+ * @brief Runs many logical clients (participants) over one endpoint
+ * container and one I/O thread.
+ *
+ *   ClientMux mux(config_path);
+ *   for (auto& node : nodes) mux.add_client(node);
+ *   mux.initialize(std::make_shared<EndpointContainer>(mux_node_id, endpoints_path));
+ *   mux.start();
+ *   mux.client("client-01")->get_sim_state(state);
+ *
+ * Each added client is an ordinary ClientCore with its own participant
+ * name, asset registration and per-service FIFO; calls are routed to the
+ * server under that name and responses back by it. What is shared is the
+ * EndpointContainer, so participants whose rpc.json client entries all name
+ * the same client_endpoint (with distinct channel IDs) use one connection,
+ * and the thread that sends, polls and completes calls for all of them.
+ */
+class ClientMux {
+public:
+    explicit ClientMux(std::string config_path);
+    ~ClientMux();
+    ClientMux(const ClientMux&) = delete;
+    ClientMux& operator=(const ClientMux&) = delete;
+
+    /**
+     * @brief Add the participant with this nodeId. Only before initialize().
+     * @return The client, owned by the mux; nullptr on error.
+     */
+    ClientCore* add_client(const std::string& node_id);
+
+    /**
+     * @brief Initialize every added client on the shared endpoint container.
+     */
+    bool initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container);
+    bool start();
+    bool stop();
+
+    /**
+     * @brief Route to a client by participant name (or nodeId); nullptr if unknown.
+     */
+    ClientCore* client(const std::string& name) const;
+    size_t size() const noexcept { return clients_.size(); }
+
+    std::string last_error() const { return last_error_; }
+
+private:
+    void io_loop();
+    void set_io_running(bool running);
+
+    std::string config_path_;
+    std::vector<std::unique_ptr<ClientCore>> clients_;
+    std::unordered_map<std::string, ClientCore*> by_name_; // participant names and nodeIds
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container_;
+    bool is_initialized_{false};
+    bool is_started_{false};
+    std::string last_error_;
+
+    ArrivalNotifier notifier_;
+    std::atomic<bool> running_{false};
+    std::thread io_thread_;
+};
+
+} // namespace hakoniwa::api
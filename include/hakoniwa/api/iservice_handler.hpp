@@ -3,24 +3,38 @@
 #include "hakoniwa/api/protocol.hpp"
 #include "hakoniwa/pdu/rpc/rpc_services_server.hpp"
 #include "hakoniwa/api/server_context.hpp"
-#include <atomic> // Added for std::atomic
+#include "hakoniwa/api/service_stats.hpp"
 
 namespace hakoniwa::api {
 
+/*
+ * Timestamps (steady clock, usec) of one request. ServerCore fills in the
+ * receipt and dispatch points; handlers stamp the reply around their
+ * service_helper.reply() call.
+ */
+struct RequestTrace {
+    uint64_t received_usec{0};
+    uint64_t dispatched_usec{0};
+    uint64_t handled_usec{0}; // handler work done, reply about to be sent
+    uint64_t replied_usec{0};
+};
+
 class IServiceHandler {
 public:
     virtual ~IServiceHandler() = default;
-    virtual void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request) = 0;
-    virtual void cancel() {
-        is_canceled_ = true;
-    }
-    virtual bool is_canceled() const {
-        return is_canceled_.load(); // Use .load() for atomic read
+    virtual void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) = 0;
+    // Reply with result_code and an empty body without running handle() (e.g. BUSY when the queue is full).
+    virtual void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) = 0;
+    // Handlers that keep a request after handle() returns (answered later)
+    // drop the one held for client_name and reply CANCELED. Returns false
+    // if nothing was held for that client.
+    virtual bool cancel_held_request(const std::string& client_name) {
+        (void)client_name;
+        return false;
     }
-    virtual void reset_canceled() {
-        is_canceled_ = false;
+    // true: at most one request of this service is handled at a time.
+    virtual bool is_serialized() const {
+        return true;
     }
-protected:
-    std::atomic<bool> is_canceled_{false}; // Changed to std::atomic<bool>
 };
 } // namespace hakoniwa::api
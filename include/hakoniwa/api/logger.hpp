@@ -0,0 +1,145 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * Compile-time log level filter.
+ * 0 = debug, 1 = info, 2 = warn, 3 = error, 4 = off.
+ * Records below the level are discarded at compile time.
+ */
+#ifndef HAKO_REMOTE_API_LOG_LEVEL
+#ifdef ENABLE_DEBUG_MESSAGES
+#define HAKO_REMOTE_API_LOG_LEVEL 0
+#else
+#define HAKO_REMOTE_API_LOG_LEVEL 1
+#endif
+#endif
+
+namespace hakoniwa::api {
+
+enum class LogLevel : uint8_t {
+    Debug = 0,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+constexpr bool log_enabled(LogLevel level) {
+    return static_cast<int>(level) - HAKO_REMOTE_API_LOG_LEVEL >= 0;
+}
+
+struct LogRecord {
+    static constexpr size_t kTextSize = 240;
+    LogLevel level{LogLevel::Info};
+    uint16_t length{0};
+    char text[kTextSize];
+};
+
+/**
+ * @brief Asynchronous logger.
+ *
+ * Producers format into a fixed-size record on their own stack and push it
+ * into a lock-free ring buffer; a background thread writes the records to
+ * stdout (debug/info) or stderr (warn/error). Producers never block, lock or
+ * allocate: they wake an idle writer through an atomic wait/notify. When the
+ * ring is full the record is dropped and counted.
+ */
+class Logger {
+public:
+    static Logger& instance();
+
+    void submit(const LogRecord& record) noexcept;
+    // Wait until every record submitted so far has been written. Returns
+    // false on timeout, or if the writer thread has already stopped.
+    bool flush(uint64_t timeout_usec = 1000000) noexcept;
+    uint64_t dropped_count() const noexcept;
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+private:
+    Logger();
+    ~Logger();
+    struct Impl;
+    Impl* impl_;
+};
+
+/*
+ * One log line. Collects `<<` operands into a LogRecord and submits it on
+ * destruction. Text beyond LogRecord::kTextSize is truncated.
+ */
+class LogLine {
+public:
+    explicit LogLine(LogLevel level) noexcept {
+        record_.level = level;
+    }
+    ~LogLine() {
+        Logger::instance().submit(record_);
+    }
+    LogLine(const LogLine&) = delete;
+    LogLine& operator=(const LogLine&) = delete;
+
+    LogLine& operator<<(std::string_view text) noexcept {
+        append(text.data(), text.size());
+        return *this;
+    }
+    LogLine& operator<<(const std::string& text) noexcept {
+        append(text.data(), text.size());
+        return *this;
+    }
+    LogLine& operator<<(const char* text) noexcept {
+        if (text != nullptr) {
+            append(text, std::strlen(text));
+        }
+        return *this;
+    }
+    LogLine& operator<<(char c) noexcept {
+        append(&c, 1);
+        return *this;
+    }
+    LogLine& operator<<(bool value) noexcept {
+        return *this << (value ? "true" : "false");
+    }
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+    LogLine& operator<<(T value) noexcept {
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        if (ec == std::errc()) {
+            append(buf, static_cast<size_t>(end - buf));
+        }
+        return *this;
+    }
+
+private:
+    void append(const char* data, size_t len) noexcept {
+        size_t room = LogRecord::kTextSize - record_.length;
+        if (len > room) {
+            len = room;
+        }
+        std::memcpy(record_.text + record_.length, data, len);
+        record_.length = static_cast<uint16_t>(record_.length + len);
+    }
+    LogRecord record_;
+};
+
+} // namespace hakoniwa::api
+
+#define HAKO_LOG(level, expr)                                                        \
+    do {                                                                             \
+        if constexpr (::hakoniwa::api::log_enabled(level)) {                      \
+            ::hakoniwa::api::LogLine hako_log_line__(level);                         \
+            hako_log_line__ << expr;                                                 \
+        }                                                                            \
+    } while (0)
+
+#define HAKO_LOG_DEBUG(expr) HAKO_LOG(::hakoniwa::api::LogLevel::Debug, expr)
+#define HAKO_LOG_INFO(expr)  HAKO_LOG(::hakoniwa::api::LogLevel::Info, expr)
+#define HAKO_LOG_WARN(expr)  HAKO_LOG(::hakoniwa::api::LogLevel::Warn, expr)
+#define HAKO_LOG_ERROR(expr) HAKO_LOG(::hakoniwa::api::LogLevel::Error, expr)
@@ -1,8 +1,70 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <string_view>
 namespace hakoniwa::api {
 
+/*
+ * Dense service IDs. The wire still carries the service name; it is mapped to
+ * an ID once when a request is received and everything after that indexes
+ * flat tables by ID.
+ */
+enum class ServiceId : uint16_t
+{
+    Join = 0,
+    GetSimState,
+    SimControl,
+    GetEvent,
+    AckEvent,
+    GetServerStats,
+    Batch,
+    SubscribeEvents,
+    Count
+};
+constexpr size_t kServiceCount = static_cast<size_t>(ServiceId::Count);
+
+constexpr std::string_view kServiceNames[kServiceCount] = {
+    "HakoRemoteApi/Join",
+    "HakoRemoteApi/GetSimState",
+    "HakoRemoteApi/SimControl",
+    "HakoRemoteApi/GetEvent",
+    "HakoRemoteApi/AckEvent",
+    "HakoRemoteApi/GetServerStats",
+    "HakoRemoteApi/Batch",
+    "HakoRemoteApi/SubscribeEvents",
+};
+
+constexpr size_t to_index(ServiceId id)
+{
+    return static_cast<size_t>(id);
+}
+
+constexpr std::string_view service_name_of(ServiceId id)
+{
+    return (id < ServiceId::Count) ? kServiceNames[to_index(id)] : std::string_view{};
+}
+
+// Returns ServiceId::Count for unknown names.
+constexpr ServiceId service_id_of(std::string_view name)
+{
+    for (size_t i = 0; i < kServiceCount; i++) {
+        if (kServiceNames[i] == name) {
+            return static_cast<ServiceId>(i);
+        }
+    }
+    return ServiceId::Count;
+}
+
+/*
+ * Batch: up to kBatchMaxOps sub-operations, each identified by the ServiceId
+ * of the service it stands for (GetSimState, SimControl, GetEvent, AckEvent).
+ * An AckEvent argument of kBatchArgLastEvent acknowledges the event returned
+ * by the closest preceding GetEvent of the same batch.
+ */
+constexpr size_t kBatchMaxOps = 8;
+constexpr uint32_t kBatchArgLastEvent = 0xFFFFFFFFu;
+
 enum class HakoSimulationState
 {
     HakoSim_Stopped = 0,
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace hakoniwa::api {
+
+/**
+ * @brief Bounded ring buffer without internal synchronization.
+ *
+ * For queues that are only touched under a lock the caller already holds.
+ * The capacity is rounded up to a power of two and all slots are allocated
+ * up front.
+ */
+template <typename T>
+class RingBuffer {
+public:
+    explicit RingBuffer(size_t capacity)
+        : capacity_(round_up_pow2(capacity)), mask_(capacity_ - 1), slots_(new T[capacity_]) {}
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /**
+     * @brief Push a value.
+     * @return false if the buffer is full (value is left untouched).
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        if (tail_ - head_ == capacity_) {
+            return false;
+        }
+        slots_[tail_ & mask_] = std::forward<U>(value);
+        tail_++;
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest value.
+     * @return false if the buffer is empty.
+     */
+    bool try_pop(T& out) {
+        if (tail_ == head_) {
+            return false;
+        }
+        out = std::move(slots_[head_ & mask_]);
+        head_++;
+        return true;
+    }
+
+    size_t size() const {
+        return tail_ - head_;
+    }
+    bool empty() const {
+        return tail_ == head_;
+    }
+    size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    static size_t round_up_pow2(size_t n) {
+        size_t cap = 2;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> slots_;
+    size_t tail_{0};
+    size_t head_{0};
+};
+
+/**
+ * @brief Bounded lock-free ring buffer (Vyukov style).
+ *
+ * Any number of threads may push concurrently. Pops are lock-free too, so the
+ * buffer works as an MPSC queue as well as an MPMC one. The capacity is rounded
+ * up to a power of two and all slots are allocated up front.
+ */
+template <typename T>
+class LockFreeRingBuffer {
+public:
+    explicit LockFreeRingBuffer(size_t capacity)
+        : capacity_(round_up_pow2(capacity)), mask_(capacity_ - 1), slots_(new Slot[capacity_]) {
+        for (size_t i = 0; i < capacity_; i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    LockFreeRingBuffer(const LockFreeRingBuffer&) = delete;
+    LockFreeRingBuffer& operator=(const LockFreeRingBuffer&) = delete;
+
+    /**
+     * @brief Push a value.
+     * @return false if the buffer is full (value is left untouched).
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::forward<U>(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pop the oldest value.
+     * @return false if the buffer is empty.
+     */
+    bool try_pop(T& out) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(slot.value);
+                    slot.sequence.store(pos + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of stored values. Exact only when no push/pop is in progress.
+     */
+    size_t size() const {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t head = head_.load(std::memory_order_acquire);
+        return (tail > head) ? (tail - head) : 0;
+    }
+    bool empty() const {
+        return size() == 0;
+    }
+    size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    static size_t round_up_pow2(size_t n) {
+        size_t cap = 2;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+    // keep producer and consumer indices on separate cache lines
+    static constexpr size_t kCacheLineSize = 64;
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(kCacheLineSize) std::atomic<size_t> tail_{0};
+    alignas(kCacheLineSize) std::atomic<size_t> head_{0};
+};
+
+} // namespace hakoniwa::api
@@ -1,5 +1,11 @@
 #pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
 
 namespace hakoniwa::api {
@@ -10,40 +16,104 @@ enum class ServerServiceContextStatus {
     SERVER_SERVICE_NUM
 };
 
-class ServerContext {
+/*
+ * Per-participant state. Entries are created in ServerCore::initialize() and
+ * never removed, so pointers stay valid for the lifetime of the server.
+ */
+class ClientContext {
 public:
-    ServerContext() = default;
-    ~ServerContext() = default;
+    ClientContext(std::string node_id, std::string name)
+        : node_id_(std::move(node_id)), name_(std::move(name)) {}
+    const std::string& get_node_id() const {
+        return node_id_;
+    }
+    const std::string& get_name() const {
+        return name_;
+    }
     ServerServiceContextStatus get_status() const {
-        return status_;
+        return status_.load();
     }
     void set_status(ServerServiceContextStatus status) {
         status_ = status;
     }
+    bool is_asset_registered() const {
+        return asset_registered_.load();
+    }
+    void set_asset_registered(bool registered) {
+        asset_registered_ = registered;
+    }
+    std::mutex& get_mutex() {
+        return mtx_;
+    }
+    // Token handed out by the last successful Join; 0 before that. Guarded by get_mutex().
+    uint64_t get_session_token() const {
+        return session_token_;
+    }
+    void set_session_token(uint64_t token) {
+        session_token_ = token;
+    }
+    void count_request() {
+        request_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    void count_error() {
+        error_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    uint64_t get_request_count() const {
+        return request_count_.load(std::memory_order_relaxed);
+    }
+    uint64_t get_error_count() const {
+        return error_count_.load(std::memory_order_relaxed);
+    }
+private:
+    std::mutex mtx_;
+    const std::string node_id_;
+    const std::string name_;
+    std::atomic<ServerServiceContextStatus> status_{ServerServiceContextStatus::SERVER_SERVICE_NOT_READY};
+    std::atomic<bool> asset_registered_{false};
+    uint64_t session_token_{0};
+    std::atomic<uint64_t> request_count_{0};
+    std::atomic<uint64_t> error_count_{0};
+};
+
+class ServerContext {
+public:
+    ServerContext() = default;
+    ~ServerContext() = default;
     std::mutex& get_mutex() {
         return mtx_;
     }
     nlohmann::json& get_config() {
         return config_;
     }
-    const std::string& get_client_node_id() const {
-        return client_node_id_;
+    // initialization only; not thread safe against find_client()
+    ClientContext* add_client(const std::string& node_id, const std::string& name) {
+        auto [it, inserted] = clients_.try_emplace(name, std::make_unique<ClientContext>(node_id, name));
+        return inserted ? it->second.get() : nullptr;
     }
-    void set_client_node_id(const std::string& node_id) {
-        client_node_id_ = node_id;
+    // O(1) lookup by client name, no allocation
+    ClientContext* find_client(std::string_view name) const {
+        auto it = clients_.find(name);
+        return (it != clients_.end()) ? it->second.get() : nullptr;
     }
-    const std::string& get_client_name() const {
-        return client_name_;
+    size_t client_count() const {
+        return clients_.size();
     }
-    void set_client_name(const std::string& client_name) {
-        client_name_ = client_name;
+    void for_each_client(const std::function<void(ClientContext&)>& fn) const {
+        for (const auto& [name, client] : clients_) {
+            fn(*client);
+        }
     }
 private:
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const noexcept {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
     std::mutex mtx_;
-    ServerServiceContextStatus status_{ServerServiceContextStatus::SERVER_SERVICE_NOT_READY};
     nlohmann::json config_;
-    std::string client_node_id_;
-    std::string client_name_;
+    // client name, context
+    std::unordered_map<std::string, std::unique_ptr<ClientContext>, NameHash, std::equal_to<>> clients_;
 };
 
-} // namespace hakoniwa::api
\ No newline at end of file
+} // namespace hakoniwa::api
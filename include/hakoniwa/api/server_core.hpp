@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <string>
 #include <string_view>
@@ -7,16 +8,54 @@
 #include <thread>
 #include <condition_variable>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <nlohmann/json.hpp>
 
+#include "hakoniwa/api/arrival_notifier.hpp"
 #include "hakoniwa/api/iservice_handler.hpp"
+#include "hakoniwa/api/ring_buffer.hpp"
 #include "hakoniwa/api/server_context.hpp"
+#include "hakoniwa/api/service_stats.hpp"
 
 namespace hakoniwa::time_source { class ITimeSource; }
 namespace hakoniwa::pdu::rpc { class RpcServicesServer; }
 
 namespace hakoniwa::api {
 
+class GetEventHandler;
+class SubscribeEventsHandler;
+
+struct RequestQueueCounters {
+    std::string service_name;
+    size_t capacity{0};
+    size_t depth{0};        // requests currently waiting for a handler
+    uint64_t enqueued{0};
+    uint64_t rejected{0};   // replied with HAKO_SERVICE_RESULT_CODE_BUSY
+    uint64_t high_water{0}; // max depth observed
+};
+
+enum class ServeMode {
+    Poll = 0,   // poll, then sleep poll_sleep_time_usec (time source)
+    Adaptive,   // busy poll for serve_spin_budget_usec, back off exponentially, then park
+};
+
+struct ServeLoopCounters {
+    uint64_t events{0};   // polls that returned a request or a cancel
+    uint64_t spins{0};    // empty polls during the spin budget
+    uint64_t backoffs{0}; // short sleeps (< poll_sleep_time_usec)
+    uint64_t parks{0};    // sleeps of poll_sleep_time_usec
+};
+
+struct ClientCounters {
+    std::string name;
+    std::string node_id;
+    ServerServiceContextStatus status{ServerServiceContextStatus::SERVER_SERVICE_NOT_READY};
+    bool asset_registered{false};
+    uint64_t requests{0};
+    uint64_t errors{0};
+};
+
 class ServerCore {
 public:
     ServerCore(std::string config_path, std::string node_id, bool enable_conductor = false);
@@ -30,11 +69,60 @@ public:
     bool is_running() const noexcept { return is_running_.load(); }
     std::string last_error() const noexcept;
     void set_conductor_timing(uint64_t delta_time_usec, uint64_t max_delay_time_usec) noexcept;
+    std::vector<RequestQueueCounters> request_queue_counters() const;
+    ServeLoopCounters serve_loop_counters() const;
+    std::vector<ClientCounters> client_counters() const;
+    /**
+     * @brief Per-service latency percentiles and reject counts.
+     * Also served to clients by HakoRemoteApi/GetServerStats.
+     */
+    std::vector<ServiceStats> stats() const;
+    bool service_stats(ServiceId id, ServiceStats& out) const;
 
 private:
+    struct QueuedRequest {
+        uint32_t server_index{0}; // index into rpc_servers_ (the participant's RPC server)
+        uint64_t received_usec{0}; // steady clock at poll receipt
+        hakoniwa::pdu::rpc::RpcRequest request;
+    };
+    struct ServiceRequestQueue {
+        ServiceRequestQueue(ServiceId id, IServiceHandler* service_handler, size_t depth)
+            : service_id(id), service_name(service_name_of(id)), handler(service_handler), requests(depth) {}
+        ServiceId service_id;
+        std::string service_name;
+        IServiceHandler* handler;
+        RingBuffer<QueuedRequest> requests; // guarded by handler_mutex_
+        uint32_t in_flight{0}; // guarded by handler_mutex_
+        // One per participant (server_index), guarded by handler_mutex_. The RPC
+        // layer lets a client have one request per service outstanding, so a
+        // REQUEST_CANCEL refers to at most one queued or running request.
+        struct ParticipantSlot {
+            bool queued{false};
+            bool in_flight{false};
+            bool cancel_requested{false};
+        };
+        std::vector<ParticipantSlot> participants;
+        std::atomic<uint64_t> enqueued{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> high_water{0};
+        LatencyHistogram queue_wait;
+        LatencyHistogram handler_time;
+        LatencyHistogram reply_time;
+        LatencyHistogram total_time;
+    };
+
     void serve();
+    bool poll_once();
+    bool poll_server(uint32_t server_index);
     void handle();
+    void record_trace(ServiceRequestQueue& queue, RequestTrace& trace);
+    ServiceRequestQueue* find_request_queue(std::string_view service_name) const;
+    void enqueue_request(uint32_t server_index, hakoniwa::pdu::rpc::RpcRequest& request,
+                         uint64_t received_usec);
+    // handler_mutex_ must be held
+    ServiceRequestQueue* pop_dispatchable_request(QueuedRequest& job);
     void conductor_loop();
+    void event_watch_loop();
     void set_last_error(std::string msg);
 
 private:
@@ -43,8 +131,14 @@ private:
     std::string last_error_;
     std::string rpc_config_path_;
     uint64_t poll_sleep_time_usec_{100000};
+    uint32_t handler_worker_count_{1};
+    uint32_t request_queue_depth_{16};
+    ServeMode serve_mode_{ServeMode::Poll};
+    uint64_t serve_spin_budget_usec_{200};
     uint64_t conductor_delta_time_usec_{1000};
     uint64_t conductor_max_delay_time_usec_{10000};
+    uint64_t event_watch_interval_usec_{10000};
+    uint64_t event_subscription_keepalive_usec_{1000000};
 
     std::atomic<bool> is_running_{false};
     std::atomic<bool> stop_requested_{false};
@@ -55,17 +149,31 @@ private:
     mutable std::mutex err_mutex_;
     std::unique_ptr<hakoniwa::time_source::ITimeSource> time_source_;
     std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container_;
-    std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> rpc_server_;
+    // one RPC server per participant bound to this server node
+    std::vector<std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer>> rpc_servers_;
+    // participant name bound to each rpc_servers_ entry; requests must carry it as client_name
+    std::vector<std::string> participant_names_;
     std::thread serve_thread_;
+    ArrivalNotifier serve_wakeup_; // cuts an adaptive-mode sleep short on stop()
+    std::atomic<uint64_t> serve_event_count_{0};
+    std::atomic<uint64_t> serve_spin_count_{0};
+    std::atomic<uint64_t> serve_backoff_count_{0};
+    std::atomic<uint64_t> serve_park_count_{0};
     std::thread conductor_thread_;
+    std::thread event_watch_thread_;
+    std::mutex event_watch_mutex_;
+    std::condition_variable event_watch_cv_;
+    bool event_parked_{false}; // guarded by event_watch_mutex_
 
-    std::thread service_handle_thread_;
-    std::mutex handler_mutex_;
+    std::vector<std::thread> service_handle_threads_;
+    mutable std::mutex handler_mutex_;
     std::condition_variable handler_cv_;
-    // service_name, handler
-    std::unordered_map<std::string, std::unique_ptr<hakoniwa::api::IServiceHandler>> handlers_;
-    // service_name, pending requests
-    std::unordered_map<std::string, hakoniwa::pdu::rpc::RpcRequest> pending_requests_;
+    // flat tables indexed by ServiceId; nullptr for services that are not registered
+    std::array<std::unique_ptr<hakoniwa::api::IServiceHandler>, kServiceCount> handlers_;
+    std::array<std::unique_ptr<ServiceRequestQueue>, kServiceCount> request_queues_;
+    size_t dispatch_cursor_{0}; // guarded by handler_mutex_
+    GetEventHandler* get_event_handler_{nullptr};               // owned by handlers_
+    SubscribeEventsHandler* subscribe_events_handler_{nullptr}; // owned by handlers_
 
     ServerContext server_context_;
 
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hakoniwa::api {
+
+inline uint64_t steady_now_usec()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+struct LatencySummary {
+    uint64_t count{0};
+    uint64_t p50_usec{0};
+    uint64_t p99_usec{0};
+    uint64_t p999_usec{0};
+    uint64_t max_usec{0};
+};
+
+/**
+ * @brief Lock-free log-linear latency histogram (HDR style).
+ *
+ * Values are bucketed by their highest set bit and then split into
+ * kSubBuckets linear sub-buckets, so the relative error of a reported
+ * percentile is below 1 / kSubBuckets. record() is wait-free apart from
+ * the max update and can be called from any number of threads.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t kSubBucketBits = 4;
+    static constexpr uint32_t kSubBuckets = 1u << kSubBucketBits;
+    // covers values up to 2^40 usec (~12 days)
+    static constexpr uint32_t kMagnitudes = 41 - kSubBucketBits;
+    static constexpr size_t kBucketCount = (kMagnitudes + 1) * kSubBuckets;
+
+    void record(uint64_t value_usec) noexcept
+    {
+        buckets_[bucket_index(value_usec)].fetch_add(1, std::memory_order_relaxed);
+        uint64_t max = max_.load(std::memory_order_relaxed);
+        while (value_usec > max && !max_.compare_exchange_weak(max, value_usec, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Percentiles over everything recorded so far.
+     * Concurrent record() calls may or may not be included.
+     */
+    LatencySummary summary() const noexcept
+    {
+        std::array<uint64_t, kBucketCount> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < kBucketCount; i++) {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        LatencySummary s;
+        s.count = total;
+        s.max_usec = max_.load(std::memory_order_relaxed);
+        if (total == 0) {
+            return s;
+        }
+        s.p50_usec = value_at(counts, total, 500);
+        s.p99_usec = value_at(counts, total, 990);
+        s.p999_usec = value_at(counts, total, 999);
+        return s;
+    }
+
+private:
+    static size_t bucket_index(uint64_t value) noexcept
+    {
+        if (value < kSubBuckets) {
+            return static_cast<size_t>(value);
+        }
+        uint32_t msb = 63 - static_cast<uint32_t>(__builtin_clzll(value));
+        uint32_t magnitude = msb - kSubBucketBits + 1;
+        if (magnitude > kMagnitudes) {
+            return kBucketCount - 1;
+        }
+        uint64_t sub = (value >> (msb - kSubBucketBits)) & (kSubBuckets - 1);
+        return magnitude * kSubBuckets + static_cast<size_t>(sub);
+    }
+    // upper bound of the values that fall into bucket `index`
+    static uint64_t bucket_upper(size_t index) noexcept
+    {
+        uint32_t magnitude = static_cast<uint32_t>(index / kSubBuckets);
+        uint64_t sub = index % kSubBuckets;
+        if (magnitude == 0) {
+            return sub;
+        }
+        uint32_t shift = magnitude - 1;
+        return (((kSubBuckets + sub + 1) << shift) - 1);
+    }
+    uint64_t value_at(const std::array<uint64_t, kBucketCount>& counts, uint64_t total,
+                      uint64_t permille) const noexcept
+    {
+        uint64_t rank = (total * permille + 999) / 1000;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBucketCount; i++) {
+            seen += counts[i];
+            if (seen >= rank) {
+                uint64_t upper = bucket_upper(i);
+                uint64_t max = max_.load(std::memory_order_relaxed);
+                return (upper < max) ? upper : max;
+            }
+        }
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    std::atomic<uint64_t> max_{0};
+};
+
+/*
+ * Per-service request latency, split at the four points a request passes
+ * through: poll receipt -> dispatch start -> handler end -> reply sent.
+ */
+struct ServiceStats {
+    std::string service_name;
+    uint64_t rejected{0};
+    LatencySummary queue_wait; // poll receipt -> dispatch start
+    LatencySummary handler;    // dispatch start -> handler end
+    LatencySummary reply;      // handler end -> reply sent
+    LatencySummary total;      // poll receipt -> reply sent
+};
+
+} // namespace hakoniwa::api
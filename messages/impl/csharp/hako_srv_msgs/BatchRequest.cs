@@ -0,0 +1,39 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using hakoniwa.pdu.interfaces;
+
+namespace hakoniwa.pdu.msgs.hako_srv_msgs
+{
+    public class BatchRequest
+    {
+        protected internal readonly IPdu _pdu;
+        public IPdu GetPdu() { return _pdu; }
+
+        public BatchRequest(IPdu pdu)
+        {
+            _pdu = pdu;
+        }
+        public string name
+        {
+            get => _pdu.GetData<string>("name");
+            set => _pdu.SetData("name", value);
+        }
+        public uint op_count
+        {
+            get => _pdu.GetData<uint>("op_count");
+            set => _pdu.SetData("op_count", value);
+        }
+        public uint[] ops
+        {
+            get => _pdu.GetDataArray<uint>("ops");
+            set => _pdu.SetData("ops", value);
+        }
+        public uint[] args
+        {
+            get => _pdu.GetDataArray<uint>("args");
+            set => _pdu.SetData("args", value);
+        }
+    }
+}
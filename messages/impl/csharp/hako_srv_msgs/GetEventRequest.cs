@@ -20,5 +20,10 @@ namespace hakoniwa.pdu.msgs.hako_srv_msgs
             get => _pdu.GetData<string>("name");
             set => _pdu.SetData("name", value);
         }
+        public uint wait_timeout_msec
+        {
+            get => _pdu.GetData<uint>("wait_timeout_msec");
+            set => _pdu.SetData("wait_timeout_msec", value);
+        }
     }
 }
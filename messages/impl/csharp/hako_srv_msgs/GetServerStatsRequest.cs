@@ -0,0 +1,29 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using hakoniwa.pdu.interfaces;
+
+namespace hakoniwa.pdu.msgs.hako_srv_msgs
+{
+    public class GetServerStatsRequest
+    {
+        protected internal readonly IPdu _pdu;
+        public IPdu GetPdu() { return _pdu; }
+
+        public GetServerStatsRequest(IPdu pdu)
+        {
+            _pdu = pdu;
+        }
+        public string name
+        {
+            get => _pdu.GetData<string>("name");
+            set => _pdu.SetData("name", value);
+        }
+        public string service_name
+        {
+            get => _pdu.GetData<string>("service_name");
+            set => _pdu.SetData("service_name", value);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using hakoniwa.pdu.interfaces;
+
+namespace hakoniwa.pdu.msgs.hako_srv_msgs
+{
+    public class GetServerStatsResponse
+    {
+        protected internal readonly IPdu _pdu;
+        public IPdu GetPdu() { return _pdu; }
+
+        public GetServerStatsResponse(IPdu pdu)
+        {
+            _pdu = pdu;
+        }
+        public string service_name
+        {
+            get => _pdu.GetData<string>("service_name");
+            set => _pdu.SetData("service_name", value);
+        }
+        public ulong count
+        {
+            get => _pdu.GetData<ulong>("count");
+            set => _pdu.SetData("count", value);
+        }
+        public ulong rejected
+        {
+            get => _pdu.GetData<ulong>("rejected");
+            set => _pdu.SetData("rejected", value);
+        }
+        public ulong queue_wait_p50_usec
+        {
+            get => _pdu.GetData<ulong>("queue_wait_p50_usec");
+            set => _pdu.SetData("queue_wait_p50_usec", value);
+        }
+        public ulong queue_wait_p99_usec
+        {
+            get => _pdu.GetData<ulong>("queue_wait_p99_usec");
+            set => _pdu.SetData("queue_wait_p99_usec", value);
+        }
+        public ulong queue_wait_p999_usec
+        {
+            get => _pdu.GetData<ulong>("queue_wait_p999_usec");
+            set => _pdu.SetData("queue_wait_p999_usec", value);
+        }
+        public ulong queue_wait_max_usec
+        {
+            get => _pdu.GetData<ulong>("queue_wait_max_usec");
+            set => _pdu.SetData("queue_wait_max_usec", value);
+        }
+        public ulong handler_p50_usec
+        {
+            get => _pdu.GetData<ulong>("handler_p50_usec");
+            set => _pdu.SetData("handler_p50_usec", value);
+        }
+        public ulong handler_p99_usec
+        {
+            get => _pdu.GetData<ulong>("handler_p99_usec");
+            set => _pdu.SetData("handler_p99_usec", value);
+        }
+        public ulong handler_p999_usec
+        {
+            get => _pdu.GetData<ulong>("handler_p999_usec");
+            set => _pdu.SetData("handler_p999_usec", value);
+        }
+        public ulong handler_max_usec
+        {
+            get => _pdu.GetData<ulong>("handler_max_usec");
+            set => _pdu.SetData("handler_max_usec", value);
+        }
+        public ulong reply_p50_usec
+        {
+            get => _pdu.GetData<ulong>("reply_p50_usec");
+            set => _pdu.SetData("reply_p50_usec", value);
+        }
+        public ulong reply_p99_usec
+        {
+            get => _pdu.GetData<ulong>("reply_p99_usec");
+            set => _pdu.SetData("reply_p99_usec", value);
+        }
+        public ulong reply_p999_usec
+        {
+            get => _pdu.GetData<ulong>("reply_p999_usec");
+            set => _pdu.SetData("reply_p999_usec", value);
+        }
+        public ulong reply_max_usec
+        {
+            get => _pdu.GetData<ulong>("reply_max_usec");
+            set => _pdu.SetData("reply_max_usec", value);
+        }
+        public ulong total_p50_usec
+        {
+            get => _pdu.GetData<ulong>("total_p50_usec");
+            set => _pdu.SetData("total_p50_usec", value);
+        }
+        public ulong total_p99_usec
+        {
+            get => _pdu.GetData<ulong>("total_p99_usec");
+            set => _pdu.SetData("total_p99_usec", value);
+        }
+        public ulong total_p999_usec
+        {
+            get => _pdu.GetData<ulong>("total_p999_usec");
+            set => _pdu.SetData("total_p999_usec", value);
+        }
+        public ulong total_max_usec
+        {
+            get => _pdu.GetData<ulong>("total_max_usec");
+            set => _pdu.SetData("total_max_usec", value);
+        }
+    }
+}
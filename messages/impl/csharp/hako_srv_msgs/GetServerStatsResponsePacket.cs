@@ -0,0 +1,53 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using hakoniwa.pdu.interfaces;
+
+namespace hakoniwa.pdu.msgs.hako_srv_msgs
+{
+    public class GetServerStatsResponsePacket
+    {
+        protected internal readonly IPdu _pdu;
+        public IPdu GetPdu() { return _pdu; }
+
+        public GetServerStatsResponsePacket(IPdu pdu)
+        {
+            _pdu = pdu;
+        }
+        private ServiceResponseHeader _header;
+        public ServiceResponseHeader header
+        {
+            get
+            {
+                if (_header == null)
+                {
+                    _header = new ServiceResponseHeader(_pdu.GetData<IPdu>("header"));
+                }
+                return _header;
+            }
+            set
+            {
+                _header = value;
+                _pdu.SetData("header", value.GetPdu());
+            }
+        }
+        private GetServerStatsResponse _body;
+        public GetServerStatsResponse body
+        {
+            get
+            {
+                if (_body == null)
+                {
+                    _body = new GetServerStatsResponse(_pdu.GetData<IPdu>("body"));
+                }
+                return _body;
+            }
+            set
+            {
+                _body = value;
+                _pdu.SetData("body", value.GetPdu());
+            }
+        }
+    }
+}
@@ -25,5 +25,10 @@ namespace hakoniwa.pdu.msgs.hako_srv_msgs
             get => _pdu.GetData<string>("message");
             set => _pdu.SetData("message", value);
         }
+        public ulong session_token
+        {
+            get => _pdu.GetData<ulong>("session_token");
+            set => _pdu.SetData("session_token", value);
+        }
     }
 }
@@ -0,0 +1,24 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using hakoniwa.pdu.interfaces;
+
+namespace hakoniwa.pdu.msgs.hako_srv_msgs
+{
+    public class SubscribeEventsRequest
+    {
+        protected internal readonly IPdu _pdu;
+        public IPdu GetPdu() { return _pdu; }
+
+        public SubscribeEventsRequest(IPdu pdu)
+        {
+            _pdu = pdu;
+        }
+        public string name
+        {
+            get => _pdu.GetData<string>("name");
+            set => _pdu.SetData("name", value);
+        }
+    }
+}
@@ -0,0 +1,164 @@
+import * as PduUtils from '../pdu_utils.js';
+import { BatchResponse } from './pdu_jstype_BatchResponse.js';
+
+
+/**
+ * Deserializes a binary PDU into a BatchResponse object.
+ * @param {ArrayBuffer} binary_data
+ * @returns { BatchResponse }
+ */
+export function pduToJs_BatchResponse(binary_data) {
+    const js_obj = new BatchResponse();
+    const meta_parser = new PduUtils.PduMetaDataParser();
+    const meta = meta_parser.load_pdu_meta(binary_data);
+    if (meta === null) {
+        throw new Error("Invalid PDU binary data: MetaData not found or corrupted");
+    }
+    binary_read_recursive_BatchResponse(meta, binary_data, js_obj, meta.base_off);
+    return js_obj;
+}
+
+export function binary_read_recursive_BatchResponse(meta, binary_data, js_obj, base_off) {
+    const view = new DataView(binary_data);
+    const littleEndian = true;
+    // member: op_count, type: uint32 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 0, 4);
+        js_obj.op_count = PduUtils.binToValue("uint32", bin);
+    }
+    
+    // member: result_codes, type: int32 (primitive)
+
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 4, 32);
+        js_obj.result_codes = PduUtils.binToArrayValues("int32", bin);
+    }
+    
+    // member: values, type: uint32 (primitive)
+
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 36, 32);
+        js_obj.values = PduUtils.binToArrayValues("uint32", bin);
+    }
+    
+    // member: master_time, type: int64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 72, 8);
+        js_obj.master_time = PduUtils.binToValue("int64", bin);
+    }
+    
+    // member: is_pdu_created, type: bool (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 80, 4);
+        js_obj.is_pdu_created = PduUtils.binToValue("bool", bin);
+    }
+    
+    // member: is_simulation_mode, type: bool (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 84, 4);
+        js_obj.is_simulation_mode = PduUtils.binToValue("bool", bin);
+    }
+    
+    // member: is_pdu_sync_mode, type: bool (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 88, 4);
+        js_obj.is_pdu_sync_mode = PduUtils.binToValue("bool", bin);
+    }
+    
+    return js_obj;
+}
+
+/**
+ * Serializes a BatchResponse object into a binary PDU.
+ * @param { BatchResponse } js_obj
+ * @returns {ArrayBuffer}
+ */
+export function jsToPdu_BatchResponse(js_obj) {
+    const base_allocator = new PduUtils.DynamicAllocator();
+    const bw_container = new PduUtils.BinaryWriterContainer(new PduUtils.PduMetaData());
+
+    binary_write_recursive_BatchResponse(0, bw_container, base_allocator, js_obj);
+
+    const base_data_size = base_allocator.size();
+    const heap_data_size = bw_container.heap_allocator.size();
+    
+    bw_container.meta.heap_off = PduUtils.PDU_META_DATA_SIZE + base_data_size;
+    bw_container.meta.total_size = bw_container.meta.heap_off + heap_data_size;
+
+    const final_buffer = new ArrayBuffer(bw_container.meta.total_size);
+    const final_view = new Uint8Array(final_buffer);
+
+    PduUtils.writeBinary(final_view, 0, bw_container.meta.to_bytes());
+    PduUtils.writeBinary(final_view, bw_container.meta.base_off, base_allocator.toArray());
+    PduUtils.writeBinary(final_view, bw_container.meta.heap_off, bw_container.heap_allocator.toArray());
+
+    return final_buffer;
+}
+
+export function binary_write_recursive_BatchResponse(parent_off, bw_container, allocator, js_obj) {
+    const littleEndian = true;
+    // member: op_count, type: uint32 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint32", js_obj.op_count, 4);
+        allocator.add(bin, parent_off + 0);
+    }
+    
+    // member: result_codes, type: int32 (primitive)
+
+    {
+        const bin = PduUtils.typeToBinArray("int32", js_obj.result_codes, 4, 32);
+        allocator.add(bin, parent_off + 4);
+    }
+    
+    // member: values, type: uint32 (primitive)
+
+    {
+        const bin = PduUtils.typeToBinArray("uint32", js_obj.values, 4, 32);
+        allocator.add(bin, parent_off + 36);
+    }
+    
+    // member: master_time, type: int64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("int64", js_obj.master_time, 8);
+        allocator.add(bin, parent_off + 72);
+    }
+    
+    // member: is_pdu_created, type: bool (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("bool", js_obj.is_pdu_created, 4);
+        allocator.add(bin, parent_off + 80);
+    }
+    
+    // member: is_simulation_mode, type: bool (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("bool", js_obj.is_simulation_mode, 4);
+        allocator.add(bin, parent_off + 84);
+    }
+    
+    // member: is_pdu_sync_mode, type: bool (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("bool", js_obj.is_pdu_sync_mode, 4);
+        allocator.add(bin, parent_off + 88);
+    }
+    
+}
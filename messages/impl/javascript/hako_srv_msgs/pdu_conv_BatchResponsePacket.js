@@ -0,0 +1,88 @@
+import * as PduUtils from '../pdu_utils.js';
+import { BatchResponsePacket } from './pdu_jstype_BatchResponsePacket.js';
+import { ServiceResponseHeader } from './pdu_jstype_ServiceResponseHeader.js';
+import { binary_read_recursive_ServiceResponseHeader, binary_write_recursive_ServiceResponseHeader } from './pdu_conv_ServiceResponseHeader.js';
+import { BatchResponse } from './pdu_jstype_BatchResponse.js';
+import { binary_read_recursive_BatchResponse, binary_write_recursive_BatchResponse } from './pdu_conv_BatchResponse.js';
+
+
+/**
+ * Deserializes a binary PDU into a BatchResponsePacket object.
+ * @param {ArrayBuffer} binary_data
+ * @returns { BatchResponsePacket }
+ */
+export function pduToJs_BatchResponsePacket(binary_data) {
+    const js_obj = new BatchResponsePacket();
+    const meta_parser = new PduUtils.PduMetaDataParser();
+    const meta = meta_parser.load_pdu_meta(binary_data);
+    if (meta === null) {
+        throw new Error("Invalid PDU binary data: MetaData not found or corrupted");
+    }
+    binary_read_recursive_BatchResponsePacket(meta, binary_data, js_obj, meta.base_off);
+    return js_obj;
+}
+
+export function binary_read_recursive_BatchResponsePacket(meta, binary_data, js_obj, base_off) {
+    const view = new DataView(binary_data);
+    const littleEndian = true;
+    // member: header, type: ServiceResponseHeader (struct)
+
+    {
+        const tmp_obj = new ServiceResponseHeader();
+        binary_read_recursive_ServiceResponseHeader(meta, binary_data, tmp_obj, base_off + 0);
+        js_obj.header = tmp_obj;
+    }
+    
+    // member: body, type: BatchResponse (struct)
+
+    {
+        const tmp_obj = new BatchResponse();
+        binary_read_recursive_BatchResponse(meta, binary_data, tmp_obj, base_off + 272);
+        js_obj.body = tmp_obj;
+    }
+    
+    return js_obj;
+}
+
+/**
+ * Serializes a BatchResponsePacket object into a binary PDU.
+ * @param { BatchResponsePacket } js_obj
+ * @returns {ArrayBuffer}
+ */
+export function jsToPdu_BatchResponsePacket(js_obj) {
+    const base_allocator = new PduUtils.DynamicAllocator();
+    const bw_container = new PduUtils.BinaryWriterContainer(new PduUtils.PduMetaData());
+
+    binary_write_recursive_BatchResponsePacket(0, bw_container, base_allocator, js_obj);
+
+    const base_data_size = base_allocator.size();
+    const heap_data_size = bw_container.heap_allocator.size();
+    
+    bw_container.meta.heap_off = PduUtils.PDU_META_DATA_SIZE + base_data_size;
+    bw_container.meta.total_size = bw_container.meta.heap_off + heap_data_size;
+
+    const final_buffer = new ArrayBuffer(bw_container.meta.total_size);
+    const final_view = new Uint8Array(final_buffer);
+
+    PduUtils.writeBinary(final_view, 0, bw_container.meta.to_bytes());
+    PduUtils.writeBinary(final_view, bw_container.meta.base_off, base_allocator.toArray());
+    PduUtils.writeBinary(final_view, bw_container.meta.heap_off, bw_container.heap_allocator.toArray());
+
+    return final_buffer;
+}
+
+export function binary_write_recursive_BatchResponsePacket(parent_off, bw_container, allocator, js_obj) {
+    const littleEndian = true;
+    // member: header, type: ServiceResponseHeader (struct)
+
+    {
+        binary_write_recursive_ServiceResponseHeader(parent_off + 0, bw_container, allocator, js_obj.header);
+    }
+    
+    // member: body, type: BatchResponse (struct)
+
+    {
+        binary_write_recursive_BatchResponse(parent_off + 272, bw_container, allocator, js_obj.body);
+    }
+    
+}
@@ -29,6 +29,14 @@ export function binary_read_recursive_GetEventRequest(meta, binary_data, js_obj,
         js_obj.name = PduUtils.binToValue("string", bin);
     }
     
+    // member: wait_timeout_msec, type: uint32 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 128, 4);
+        js_obj.wait_timeout_msec = PduUtils.binToValue("uint32", bin);
+    }
+    
     return js_obj;
 }
 
@@ -69,4 +77,12 @@ export function binary_write_recursive_GetEventRequest(parent_off, bw_container,
         allocator.add(bin, parent_off + 0);
     }
     
+    // member: wait_timeout_msec, type: uint32 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint32", js_obj.wait_timeout_msec, 4);
+        allocator.add(bin, parent_off + 128);
+    }
+    
 }
@@ -0,0 +1,360 @@
+import * as PduUtils from '../pdu_utils.js';
+import { GetServerStatsResponse } from './pdu_jstype_GetServerStatsResponse.js';
+
+
+/**
+ * Deserializes a binary PDU into a GetServerStatsResponse object.
+ * @param {ArrayBuffer} binary_data
+ * @returns { GetServerStatsResponse }
+ */
+export function pduToJs_GetServerStatsResponse(binary_data) {
+    const js_obj = new GetServerStatsResponse();
+    const meta_parser = new PduUtils.PduMetaDataParser();
+    const meta = meta_parser.load_pdu_meta(binary_data);
+    if (meta === null) {
+        throw new Error("Invalid PDU binary data: MetaData not found or corrupted");
+    }
+    binary_read_recursive_GetServerStatsResponse(meta, binary_data, js_obj, meta.base_off);
+    return js_obj;
+}
+
+export function binary_read_recursive_GetServerStatsResponse(meta, binary_data, js_obj, base_off) {
+    const view = new DataView(binary_data);
+    const littleEndian = true;
+    // member: service_name, type: string (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 0, 128);
+        js_obj.service_name = PduUtils.binToValue("string", bin);
+    }
+    
+    // member: count, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 128, 8);
+        js_obj.count = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: rejected, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 136, 8);
+        js_obj.rejected = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: queue_wait_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 144, 8);
+        js_obj.queue_wait_p50_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: queue_wait_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 152, 8);
+        js_obj.queue_wait_p99_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: queue_wait_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 160, 8);
+        js_obj.queue_wait_p999_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: queue_wait_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 168, 8);
+        js_obj.queue_wait_max_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: handler_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 176, 8);
+        js_obj.handler_p50_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: handler_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 184, 8);
+        js_obj.handler_p99_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: handler_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 192, 8);
+        js_obj.handler_p999_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: handler_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 200, 8);
+        js_obj.handler_max_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: reply_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 208, 8);
+        js_obj.reply_p50_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: reply_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 216, 8);
+        js_obj.reply_p99_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: reply_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 224, 8);
+        js_obj.reply_p999_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: reply_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 232, 8);
+        js_obj.reply_max_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: total_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 240, 8);
+        js_obj.total_p50_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: total_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 248, 8);
+        js_obj.total_p99_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: total_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 256, 8);
+        js_obj.total_p999_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    // member: total_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 264, 8);
+        js_obj.total_max_usec = PduUtils.binToValue("uint64", bin);
+    }
+    
+    return js_obj;
+}
+
+/**
+ * Serializes a GetServerStatsResponse object into a binary PDU.
+ * @param { GetServerStatsResponse } js_obj
+ * @returns {ArrayBuffer}
+ */
+export function jsToPdu_GetServerStatsResponse(js_obj) {
+    const base_allocator = new PduUtils.DynamicAllocator();
+    const bw_container = new PduUtils.BinaryWriterContainer(new PduUtils.PduMetaData());
+
+    binary_write_recursive_GetServerStatsResponse(0, bw_container, base_allocator, js_obj);
+
+    const base_data_size = base_allocator.size();
+    const heap_data_size = bw_container.heap_allocator.size();
+    
+    bw_container.meta.heap_off = PduUtils.PDU_META_DATA_SIZE + base_data_size;
+    bw_container.meta.total_size = bw_container.meta.heap_off + heap_data_size;
+
+    const final_buffer = new ArrayBuffer(bw_container.meta.total_size);
+    const final_view = new Uint8Array(final_buffer);
+
+    PduUtils.writeBinary(final_view, 0, bw_container.meta.to_bytes());
+    PduUtils.writeBinary(final_view, bw_container.meta.base_off, base_allocator.toArray());
+    PduUtils.writeBinary(final_view, bw_container.meta.heap_off, bw_container.heap_allocator.toArray());
+
+    return final_buffer;
+}
+
+export function binary_write_recursive_GetServerStatsResponse(parent_off, bw_container, allocator, js_obj) {
+    const littleEndian = true;
+    // member: service_name, type: string (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("string", js_obj.service_name, 128);
+        allocator.add(bin, parent_off + 0);
+    }
+    
+    // member: count, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.count, 8);
+        allocator.add(bin, parent_off + 128);
+    }
+    
+    // member: rejected, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.rejected, 8);
+        allocator.add(bin, parent_off + 136);
+    }
+    
+    // member: queue_wait_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.queue_wait_p50_usec, 8);
+        allocator.add(bin, parent_off + 144);
+    }
+    
+    // member: queue_wait_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.queue_wait_p99_usec, 8);
+        allocator.add(bin, parent_off + 152);
+    }
+    
+    // member: queue_wait_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.queue_wait_p999_usec, 8);
+        allocator.add(bin, parent_off + 160);
+    }
+    
+    // member: queue_wait_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.queue_wait_max_usec, 8);
+        allocator.add(bin, parent_off + 168);
+    }
+    
+    // member: handler_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.handler_p50_usec, 8);
+        allocator.add(bin, parent_off + 176);
+    }
+    
+    // member: handler_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.handler_p99_usec, 8);
+        allocator.add(bin, parent_off + 184);
+    }
+    
+    // member: handler_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.handler_p999_usec, 8);
+        allocator.add(bin, parent_off + 192);
+    }
+    
+    // member: handler_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.handler_max_usec, 8);
+        allocator.add(bin, parent_off + 200);
+    }
+    
+    // member: reply_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.reply_p50_usec, 8);
+        allocator.add(bin, parent_off + 208);
+    }
+    
+    // member: reply_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.reply_p99_usec, 8);
+        allocator.add(bin, parent_off + 216);
+    }
+    
+    // member: reply_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.reply_p999_usec, 8);
+        allocator.add(bin, parent_off + 224);
+    }
+    
+    // member: reply_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.reply_max_usec, 8);
+        allocator.add(bin, parent_off + 232);
+    }
+    
+    // member: total_p50_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.total_p50_usec, 8);
+        allocator.add(bin, parent_off + 240);
+    }
+    
+    // member: total_p99_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.total_p99_usec, 8);
+        allocator.add(bin, parent_off + 248);
+    }
+    
+    // member: total_p999_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.total_p999_usec, 8);
+        allocator.add(bin, parent_off + 256);
+    }
+    
+    // member: total_max_usec, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.total_max_usec, 8);
+        allocator.add(bin, parent_off + 264);
+    }
+    
+}
@@ -29,6 +29,14 @@ export function binary_read_recursive_JoinRequest(meta, binary_data, js_obj, bas
         js_obj.name = PduUtils.binToValue("string", bin);
     }
     
+    // member: session_token, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 128, 8);
+        js_obj.session_token = PduUtils.binToValue("uint64", bin);
+    }
+    
     return js_obj;
 }
 
@@ -69,4 +77,12 @@ export function binary_write_recursive_JoinRequest(parent_off, bw_container, all
         allocator.add(bin, parent_off + 0);
     }
     
+    // member: session_token, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.session_token, 8);
+        allocator.add(bin, parent_off + 128);
+    }
+    
 }
@@ -37,7 +37,7 @@ export function binary_read_recursive_JoinRequestPacket(meta, binary_data, js_ob
 
     {
         const tmp_obj = new JoinRequest();
-        binary_read_recursive_JoinRequest(meta, binary_data, tmp_obj, base_off + 268);
+        binary_read_recursive_JoinRequest(meta, binary_data, tmp_obj, base_off + 272);
         js_obj.body = tmp_obj;
     }
     
@@ -82,7 +82,7 @@ export function binary_write_recursive_JoinRequestPacket(parent_off, bw_containe
     // member: body, type: JoinRequest (struct)
 
     {
-        binary_write_recursive_JoinRequest(parent_off + 268, bw_container, allocator, js_obj.body);
+        binary_write_recursive_JoinRequest(parent_off + 272, bw_container, allocator, js_obj.body);
     }
     
 }
@@ -37,6 +37,14 @@ export function binary_read_recursive_JoinResponse(meta, binary_data, js_obj, ba
         js_obj.message = PduUtils.binToValue("string", bin);
     }
     
+    // member: session_token, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.readBinary(binary_data, base_off + 136, 8);
+        js_obj.session_token = PduUtils.binToValue("uint64", bin);
+    }
+    
     return js_obj;
 }
 
@@ -85,4 +93,12 @@ export function binary_write_recursive_JoinResponse(parent_off, bw_container, al
         allocator.add(bin, parent_off + 4);
     }
     
+    // member: session_token, type: uint64 (primitive)
+
+    
+    {
+        const bin = PduUtils.typeToBin("uint64", js_obj.session_token, 8);
+        allocator.add(bin, parent_off + 136);
+    }
+    
 }
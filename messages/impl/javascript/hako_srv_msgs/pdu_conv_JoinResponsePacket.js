@@ -37,7 +37,7 @@ export function binary_read_recursive_JoinResponsePacket(meta, binary_data, js_o
 
     {
         const tmp_obj = new JoinResponse();
-        binary_read_recursive_JoinResponse(meta, binary_data, tmp_obj, base_off + 268);
+        binary_read_recursive_JoinResponse(meta, binary_data, tmp_obj, base_off + 272);
         js_obj.body = tmp_obj;
     }
     
@@ -82,7 +82,7 @@ export function binary_write_recursive_JoinResponsePacket(parent_off, bw_contain
     // member: body, type: JoinResponse (struct)
 
     {
-        binary_write_recursive_JoinResponse(parent_off + 268, bw_container, allocator, js_obj.body);
+        binary_write_recursive_JoinResponse(parent_off + 272, bw_container, allocator, js_obj.body);
     }
     
 }
@@ -0,0 +1,112 @@
+
+
+/**
+ * ROS message: hako_srv_msgs/BatchRequest
+ * Generated by hakoniwa-ros2pdu.
+ */
+export class BatchRequest {
+/** @type { string } */
+    name;
+/** @type { number } */
+    op_count;
+/** @type { number[] } */
+    ops;
+/** @type { number[] } */
+    args;
+
+
+    constructor() {
+        this.name = "";
+        this.op_count = 0;
+        this.ops = [];
+        this.args = [];
+    }
+
+    /**
+     * @returns {object}
+     */
+    toDict() {
+        const d = {};
+        {
+            // handle field 'name'
+            const field_val = this.name;
+            if (typeof field_val?.toDict === 'function') {
+                d['name'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['name'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['name'] = field_val;
+            }
+        }
+        {
+            // handle field 'op_count'
+            const field_val = this.op_count;
+            if (typeof field_val?.toDict === 'function') {
+                d['op_count'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['op_count'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['op_count'] = field_val;
+            }
+        }
+        {
+            // handle field 'ops'
+            const field_val = this.ops;
+            if (typeof field_val?.toDict === 'function') {
+                d['ops'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['ops'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['ops'] = field_val;
+            }
+        }
+        {
+            // handle field 'args'
+            const field_val = this.args;
+            if (typeof field_val?.toDict === 'function') {
+                d['args'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['args'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['args'] = field_val;
+            }
+        }
+        return d;
+    }
+
+    /**
+     * @param {object} d
+     * @returns { BatchRequest }
+     */
+    static fromDict(d) {
+        const obj = new BatchRequest();
+        if (d.hasOwnProperty('name')) {
+            obj.name = d.name;
+        }
+        if (d.hasOwnProperty('op_count')) {
+            obj.op_count = d.op_count;
+        }
+        if (d.hasOwnProperty('ops')) {
+            obj.ops = d.ops;
+        }
+        if (d.hasOwnProperty('args')) {
+            obj.args = d.args;
+        }
+        return obj;
+    }
+
+    /**
+     * @returns {string}
+     */
+    toJSON(indent = 2) {
+        return JSON.stringify(this.toDict(), null, indent);
+    }
+
+    /**
+     * @param {string} json_str
+     * @returns { BatchRequest }
+     */
+    static fromJSON(json_str) {
+        return this.fromDict(JSON.parse(json_str));
+    }
+}
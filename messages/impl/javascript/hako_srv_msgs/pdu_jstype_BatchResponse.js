@@ -0,0 +1,163 @@
+
+
+/**
+ * ROS message: hako_srv_msgs/BatchResponse
+ * Generated by hakoniwa-ros2pdu.
+ */
+export class BatchResponse {
+/** @type { number } */
+    op_count;
+/** @type { number[] } */
+    result_codes;
+/** @type { number[] } */
+    values;
+/** @type { bigint } */
+    master_time;
+/** @type { boolean } */
+    is_pdu_created;
+/** @type { boolean } */
+    is_simulation_mode;
+/** @type { boolean } */
+    is_pdu_sync_mode;
+
+
+    constructor() {
+        this.op_count = 0;
+        this.result_codes = [];
+        this.values = [];
+        this.master_time = 0n;
+        this.is_pdu_created = false;
+        this.is_simulation_mode = false;
+        this.is_pdu_sync_mode = false;
+    }
+
+    /**
+     * @returns {object}
+     */
+    toDict() {
+        const d = {};
+        {
+            // handle field 'op_count'
+            const field_val = this.op_count;
+            if (typeof field_val?.toDict === 'function') {
+                d['op_count'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['op_count'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['op_count'] = field_val;
+            }
+        }
+        {
+            // handle field 'result_codes'
+            const field_val = this.result_codes;
+            if (typeof field_val?.toDict === 'function') {
+                d['result_codes'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['result_codes'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['result_codes'] = field_val;
+            }
+        }
+        {
+            // handle field 'values'
+            const field_val = this.values;
+            if (typeof field_val?.toDict === 'function') {
+                d['values'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['values'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['values'] = field_val;
+            }
+        }
+        {
+            // handle field 'master_time'
+            const field_val = this.master_time;
+            if (typeof field_val?.toDict === 'function') {
+                d['master_time'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['master_time'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['master_time'] = field_val;
+            }
+        }
+        {
+            // handle field 'is_pdu_created'
+            const field_val = this.is_pdu_created;
+            if (typeof field_val?.toDict === 'function') {
+                d['is_pdu_created'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['is_pdu_created'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['is_pdu_created'] = field_val;
+            }
+        }
+        {
+            // handle field 'is_simulation_mode'
+            const field_val = this.is_simulation_mode;
+            if (typeof field_val?.toDict === 'function') {
+                d['is_simulation_mode'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['is_simulation_mode'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['is_simulation_mode'] = field_val;
+            }
+        }
+        {
+            // handle field 'is_pdu_sync_mode'
+            const field_val = this.is_pdu_sync_mode;
+            if (typeof field_val?.toDict === 'function') {
+                d['is_pdu_sync_mode'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['is_pdu_sync_mode'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['is_pdu_sync_mode'] = field_val;
+            }
+        }
+        return d;
+    }
+
+    /**
+     * @param {object} d
+     * @returns { BatchResponse }
+     */
+    static fromDict(d) {
+        const obj = new BatchResponse();
+        if (d.hasOwnProperty('op_count')) {
+            obj.op_count = d.op_count;
+        }
+        if (d.hasOwnProperty('result_codes')) {
+            obj.result_codes = d.result_codes;
+        }
+        if (d.hasOwnProperty('values')) {
+            obj.values = d.values;
+        }
+        if (d.hasOwnProperty('master_time')) {
+            obj.master_time = d.master_time;
+        }
+        if (d.hasOwnProperty('is_pdu_created')) {
+            obj.is_pdu_created = d.is_pdu_created;
+        }
+        if (d.hasOwnProperty('is_simulation_mode')) {
+            obj.is_simulation_mode = d.is_simulation_mode;
+        }
+        if (d.hasOwnProperty('is_pdu_sync_mode')) {
+            obj.is_pdu_sync_mode = d.is_pdu_sync_mode;
+        }
+        return obj;
+    }
+
+    /**
+     * @returns {string}
+     */
+    toJSON(indent = 2) {
+        return JSON.stringify(this.toDict(), null, indent);
+    }
+
+    /**
+     * @param {string} json_str
+     * @returns { BatchResponse }
+     */
+    static fromJSON(json_str) {
+        return this.fromDict(JSON.parse(json_str));
+    }
+}
@@ -0,0 +1,86 @@
+import { BatchResponse } from '../hako_srv_msgs/pdu_jstype_BatchResponse.js';
+import { ServiceResponseHeader } from '../hako_srv_msgs/pdu_jstype_ServiceResponseHeader.js';
+
+
+/**
+ * ROS message: hako_srv_msgs/BatchResponsePacket
+ * Generated by hakoniwa-ros2pdu.
+ */
+export class BatchResponsePacket {
+/** @type { ServiceResponseHeader } */
+    header;
+/** @type { BatchResponse } */
+    body;
+
+
+    constructor() {
+        this.header = new ServiceResponseHeader();
+        this.body = new BatchResponse();
+    }
+
+    /**
+     * @returns {object}
+     */
+    toDict() {
+        const d = {};
+        {
+            // handle field 'header'
+            const field_val = this.header;
+            if (typeof field_val?.toDict === 'function') {
+                d['header'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['header'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['header'] = field_val;
+            }
+        }
+        {
+            // handle field 'body'
+            const field_val = this.body;
+            if (typeof field_val?.toDict === 'function') {
+                d['body'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['body'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['body'] = field_val;
+            }
+        }
+        return d;
+    }
+
+    /**
+     * @param {object} d
+     * @returns { BatchResponsePacket }
+     */
+    static fromDict(d) {
+        const obj = new BatchResponsePacket();
+        if (d.hasOwnProperty('header')) {
+            const field_class = ServiceResponseHeader;
+            if (d.header) {
+                obj.header = field_class.fromDict(d.header);
+            }
+        }
+        if (d.hasOwnProperty('body')) {
+            const field_class = BatchResponse;
+            if (d.body) {
+                obj.body = field_class.fromDict(d.body);
+            }
+        }
+        return obj;
+    }
+
+    /**
+     * @returns {string}
+     */
+    toJSON(indent = 2) {
+        return JSON.stringify(this.toDict(), null, indent);
+    }
+
+    /**
+     * @param {string} json_str
+     * @returns { BatchResponsePacket }
+     */
+    static fromJSON(json_str) {
+        return this.fromDict(JSON.parse(json_str));
+    }
+}
@@ -7,10 +7,13 @@
 export class GetEventRequest {
 /** @type { string } */
     name;
+/** @type { number } */
+    wait_timeout_msec;
 
 
     constructor() {
         this.name = "";
+        this.wait_timeout_msec = 0;
     }
 
     /**
@@ -29,6 +32,17 @@ export class GetEventRequest {
                 d['name'] = field_val;
             }
         }
+        {
+            // handle field 'wait_timeout_msec'
+            const field_val = this.wait_timeout_msec;
+            if (typeof field_val?.toDict === 'function') {
+                d['wait_timeout_msec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['wait_timeout_msec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['wait_timeout_msec'] = field_val;
+            }
+        }
         return d;
     }
 
@@ -41,6 +55,9 @@ export class GetEventRequest {
         if (d.hasOwnProperty('name')) {
             obj.name = d.name;
         }
+        if (d.hasOwnProperty('wait_timeout_msec')) {
+            obj.wait_timeout_msec = d.wait_timeout_msec;
+        }
         return obj;
     }
 
@@ -0,0 +1,78 @@
+
+
+/**
+ * ROS message: hako_srv_msgs/GetServerStatsRequest
+ * Generated by hakoniwa-ros2pdu.
+ */
+export class GetServerStatsRequest {
+/** @type { string } */
+    name;
+/** @type { string } */
+    service_name;
+
+
+    constructor() {
+        this.name = "";
+        this.service_name = "";
+    }
+
+    /**
+     * @returns {object}
+     */
+    toDict() {
+        const d = {};
+        {
+            // handle field 'name'
+            const field_val = this.name;
+            if (typeof field_val?.toDict === 'function') {
+                d['name'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['name'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['name'] = field_val;
+            }
+        }
+        {
+            // handle field 'service_name'
+            const field_val = this.service_name;
+            if (typeof field_val?.toDict === 'function') {
+                d['service_name'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['service_name'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['service_name'] = field_val;
+            }
+        }
+        return d;
+    }
+
+    /**
+     * @param {object} d
+     * @returns { GetServerStatsRequest }
+     */
+    static fromDict(d) {
+        const obj = new GetServerStatsRequest();
+        if (d.hasOwnProperty('name')) {
+            obj.name = d.name;
+        }
+        if (d.hasOwnProperty('service_name')) {
+            obj.service_name = d.service_name;
+        }
+        return obj;
+    }
+
+    /**
+     * @returns {string}
+     */
+    toJSON(indent = 2) {
+        return JSON.stringify(this.toDict(), null, indent);
+    }
+
+    /**
+     * @param {string} json_str
+     * @returns { GetServerStatsRequest }
+     */
+    static fromJSON(json_str) {
+        return this.fromDict(JSON.parse(json_str));
+    }
+}
@@ -0,0 +1,367 @@
+
+
+/**
+ * ROS message: hako_srv_msgs/GetServerStatsResponse
+ * Generated by hakoniwa-ros2pdu.
+ */
+export class GetServerStatsResponse {
+/** @type { string } */
+    service_name;
+/** @type { bigint } */
+    count;
+/** @type { bigint } */
+    rejected;
+/** @type { bigint } */
+    queue_wait_p50_usec;
+/** @type { bigint } */
+    queue_wait_p99_usec;
+/** @type { bigint } */
+    queue_wait_p999_usec;
+/** @type { bigint } */
+    queue_wait_max_usec;
+/** @type { bigint } */
+    handler_p50_usec;
+/** @type { bigint } */
+    handler_p99_usec;
+/** @type { bigint } */
+    handler_p999_usec;
+/** @type { bigint } */
+    handler_max_usec;
+/** @type { bigint } */
+    reply_p50_usec;
+/** @type { bigint } */
+    reply_p99_usec;
+/** @type { bigint } */
+    reply_p999_usec;
+/** @type { bigint } */
+    reply_max_usec;
+/** @type { bigint } */
+    total_p50_usec;
+/** @type { bigint } */
+    total_p99_usec;
+/** @type { bigint } */
+    total_p999_usec;
+/** @type { bigint } */
+    total_max_usec;
+
+
+    constructor() {
+        this.service_name = "";
+        this.count = 0n;
+        this.rejected = 0n;
+        this.queue_wait_p50_usec = 0n;
+        this.queue_wait_p99_usec = 0n;
+        this.queue_wait_p999_usec = 0n;
+        this.queue_wait_max_usec = 0n;
+        this.handler_p50_usec = 0n;
+        this.handler_p99_usec = 0n;
+        this.handler_p999_usec = 0n;
+        this.handler_max_usec = 0n;
+        this.reply_p50_usec = 0n;
+        this.reply_p99_usec = 0n;
+        this.reply_p999_usec = 0n;
+        this.reply_max_usec = 0n;
+        this.total_p50_usec = 0n;
+        this.total_p99_usec = 0n;
+        this.total_p999_usec = 0n;
+        this.total_max_usec = 0n;
+    }
+
+    /**
+     * @returns {object}
+     */
+    toDict() {
+        const d = {};
+        {
+            // handle field 'service_name'
+            const field_val = this.service_name;
+            if (typeof field_val?.toDict === 'function') {
+                d['service_name'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['service_name'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['service_name'] = field_val;
+            }
+        }
+        {
+            // handle field 'count'
+            const field_val = this.count;
+            if (typeof field_val?.toDict === 'function') {
+                d['count'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['count'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['count'] = field_val;
+            }
+        }
+        {
+            // handle field 'rejected'
+            const field_val = this.rejected;
+            if (typeof field_val?.toDict === 'function') {
+                d['rejected'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['rejected'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['rejected'] = field_val;
+            }
+        }
+        {
+            // handle field 'queue_wait_p50_usec'
+            const field_val = this.queue_wait_p50_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['queue_wait_p50_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['queue_wait_p50_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['queue_wait_p50_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'queue_wait_p99_usec'
+            const field_val = this.queue_wait_p99_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['queue_wait_p99_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['queue_wait_p99_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['queue_wait_p99_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'queue_wait_p999_usec'
+            const field_val = this.queue_wait_p999_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['queue_wait_p999_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['queue_wait_p999_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['queue_wait_p999_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'queue_wait_max_usec'
+            const field_val = this.queue_wait_max_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['queue_wait_max_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['queue_wait_max_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['queue_wait_max_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'handler_p50_usec'
+            const field_val = this.handler_p50_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['handler_p50_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['handler_p50_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['handler_p50_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'handler_p99_usec'
+            const field_val = this.handler_p99_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['handler_p99_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['handler_p99_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['handler_p99_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'handler_p999_usec'
+            const field_val = this.handler_p999_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['handler_p999_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['handler_p999_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['handler_p999_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'handler_max_usec'
+            const field_val = this.handler_max_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['handler_max_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['handler_max_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['handler_max_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'reply_p50_usec'
+            const field_val = this.reply_p50_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['reply_p50_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['reply_p50_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['reply_p50_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'reply_p99_usec'
+            const field_val = this.reply_p99_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['reply_p99_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['reply_p99_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['reply_p99_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'reply_p999_usec'
+            const field_val = this.reply_p999_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['reply_p999_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['reply_p999_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['reply_p999_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'reply_max_usec'
+            const field_val = this.reply_max_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['reply_max_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['reply_max_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['reply_max_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'total_p50_usec'
+            const field_val = this.total_p50_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['total_p50_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['total_p50_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['total_p50_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'total_p99_usec'
+            const field_val = this.total_p99_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['total_p99_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['total_p99_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['total_p99_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'total_p999_usec'
+            const field_val = this.total_p999_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['total_p999_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['total_p999_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['total_p999_usec'] = field_val;
+            }
+        }
+        {
+            // handle field 'total_max_usec'
+            const field_val = this.total_max_usec;
+            if (typeof field_val?.toDict === 'function') {
+                d['total_max_usec'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['total_max_usec'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['total_max_usec'] = field_val;
+            }
+        }
+        return d;
+    }
+
+    /**
+     * @param {object} d
+     * @returns { GetServerStatsResponse }
+     */
+    static fromDict(d) {
+        const obj = new GetServerStatsResponse();
+        if (d.hasOwnProperty('service_name')) {
+            obj.service_name = d.service_name;
+        }
+        if (d.hasOwnProperty('count')) {
+            obj.count = d.count;
+        }
+        if (d.hasOwnProperty('rejected')) {
+            obj.rejected = d.rejected;
+        }
+        if (d.hasOwnProperty('queue_wait_p50_usec')) {
+            obj.queue_wait_p50_usec = d.queue_wait_p50_usec;
+        }
+        if (d.hasOwnProperty('queue_wait_p99_usec')) {
+            obj.queue_wait_p99_usec = d.queue_wait_p99_usec;
+        }
+        if (d.hasOwnProperty('queue_wait_p999_usec')) {
+            obj.queue_wait_p999_usec = d.queue_wait_p999_usec;
+        }
+        if (d.hasOwnProperty('queue_wait_max_usec')) {
+            obj.queue_wait_max_usec = d.queue_wait_max_usec;
+        }
+        if (d.hasOwnProperty('handler_p50_usec')) {
+            obj.handler_p50_usec = d.handler_p50_usec;
+        }
+        if (d.hasOwnProperty('handler_p99_usec')) {
+            obj.handler_p99_usec = d.handler_p99_usec;
+        }
+        if (d.hasOwnProperty('handler_p999_usec')) {
+            obj.handler_p999_usec = d.handler_p999_usec;
+        }
+        if (d.hasOwnProperty('handler_max_usec')) {
+            obj.handler_max_usec = d.handler_max_usec;
+        }
+        if (d.hasOwnProperty('reply_p50_usec')) {
+            obj.reply_p50_usec = d.reply_p50_usec;
+        }
+        if (d.hasOwnProperty('reply_p99_usec')) {
+            obj.reply_p99_usec = d.reply_p99_usec;
+        }
+        if (d.hasOwnProperty('reply_p999_usec')) {
+            obj.reply_p999_usec = d.reply_p999_usec;
+        }
+        if (d.hasOwnProperty('reply_max_usec')) {
+            obj.reply_max_usec = d.reply_max_usec;
+        }
+        if (d.hasOwnProperty('total_p50_usec')) {
+            obj.total_p50_usec = d.total_p50_usec;
+        }
+        if (d.hasOwnProperty('total_p99_usec')) {
+            obj.total_p99_usec = d.total_p99_usec;
+        }
+        if (d.hasOwnProperty('total_p999_usec')) {
+            obj.total_p999_usec = d.total_p999_usec;
+        }
+        if (d.hasOwnProperty('total_max_usec')) {
+            obj.total_max_usec = d.total_max_usec;
+        }
+        return obj;
+    }
+
+    /**
+     * @returns {string}
+     */
+    toJSON(indent = 2) {
+        return JSON.stringify(this.toDict(), null, indent);
+    }
+
+    /**
+     * @param {string} json_str
+     * @returns { GetServerStatsResponse }
+     */
+    static fromJSON(json_str) {
+        return this.fromDict(JSON.parse(json_str));
+    }
+}
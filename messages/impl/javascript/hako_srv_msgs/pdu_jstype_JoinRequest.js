@@ -7,10 +7,13 @@
 export class JoinRequest {
 /** @type { string } */
     name;
+/** @type { bigint } */
+    session_token;
 
 
     constructor() {
         this.name = "";
+        this.session_token = 0n;
     }
 
     /**
@@ -29,6 +32,17 @@ export class JoinRequest {
                 d['name'] = field_val;
             }
         }
+        {
+            // handle field 'session_token'
+            const field_val = this.session_token;
+            if (typeof field_val?.toDict === 'function') {
+                d['session_token'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['session_token'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['session_token'] = field_val;
+            }
+        }
         return d;
     }
 
@@ -41,6 +55,9 @@ export class JoinRequest {
         if (d.hasOwnProperty('name')) {
             obj.name = d.name;
         }
+        if (d.hasOwnProperty('session_token')) {
+            obj.session_token = d.session_token;
+        }
         return obj;
     }
 
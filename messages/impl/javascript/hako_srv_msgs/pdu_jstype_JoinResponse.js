@@ -9,11 +9,14 @@ export class JoinResponse {
     status_code;
 /** @type { string } */
     message;
+/** @type { bigint } */
+    session_token;
 
 
     constructor() {
         this.status_code = 0;
         this.message = "";
+        this.session_token = 0n;
     }
 
     /**
@@ -43,6 +46,17 @@ export class JoinResponse {
                 d['message'] = field_val;
             }
         }
+        {
+            // handle field 'session_token'
+            const field_val = this.session_token;
+            if (typeof field_val?.toDict === 'function') {
+                d['session_token'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['session_token'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['session_token'] = field_val;
+            }
+        }
         return d;
     }
 
@@ -58,6 +72,9 @@ export class JoinResponse {
         if (d.hasOwnProperty('message')) {
             obj.message = d.message;
         }
+        if (d.hasOwnProperty('session_token')) {
+            obj.session_token = d.session_token;
+        }
         return obj;
     }
 
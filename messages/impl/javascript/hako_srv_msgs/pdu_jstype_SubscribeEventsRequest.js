@@ -0,0 +1,61 @@
+
+
+/**
+ * ROS message: hako_srv_msgs/SubscribeEventsRequest
+ * Generated by hakoniwa-ros2pdu.
+ */
+export class SubscribeEventsRequest {
+/** @type { string } */
+    name;
+
+
+    constructor() {
+        this.name = "";
+    }
+
+    /**
+     * @returns {object}
+     */
+    toDict() {
+        const d = {};
+        {
+            // handle field 'name'
+            const field_val = this.name;
+            if (typeof field_val?.toDict === 'function') {
+                d['name'] = field_val.toDict();
+            } else if (Array.isArray(field_val)) {
+                d['name'] = field_val.map(item => typeof item?.toDict === 'function' ? item.toDict() : item);
+            } else {
+                d['name'] = field_val;
+            }
+        }
+        return d;
+    }
+
+    /**
+     * @param {object} d
+     * @returns { SubscribeEventsRequest }
+     */
+    static fromDict(d) {
+        const obj = new SubscribeEventsRequest();
+        if (d.hasOwnProperty('name')) {
+            obj.name = d.name;
+        }
+        return obj;
+    }
+
+    /**
+     * @returns {string}
+     */
+    toJSON(indent = 2) {
+        return JSON.stringify(this.toDict(), null, indent);
+    }
+
+    /**
+     * @param {string} json_str
+     * @returns { SubscribeEventsRequest }
+     */
+    static fromJSON(json_str) {
+        return this.fromDict(JSON.parse(json_str));
+    }
+}
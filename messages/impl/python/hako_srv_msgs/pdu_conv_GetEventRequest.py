@@ -30,6 +30,17 @@ def binary_read_recursive_GetEventRequest(meta: binary_io.PduMetaData, binary_da
     bin = binary_io.readBinary(binary_data, base_off + 0, 128)
     py_obj.name = binary_io.binTovalue("string", bin)
     
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: wait_timeout_msec 
+    # type_name: uint32 
+    # offset: 128 size: 4 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 128, 4)
+    py_obj.wait_timeout_msec = binary_io.binTovalue("uint32", bin)
+    
     return py_obj
 
 
@@ -76,6 +87,20 @@ def binary_write_recursive_GetEventRequest(parent_off: int, bw_container: Binary
     bin = get_binary(type, bin, 128)
     allocator.add(bin, expected_offset=parent_off + off)
     
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: wait_timeout_msec 
+    # type_name: uint32 
+    # offset: 128 size: 4 
+    # array_len: 1
+    type = "uint32"
+    off = 128
+
+    
+    bin = binary_io.typeTobin(type, py_obj.wait_timeout_msec)
+    bin = get_binary(type, bin, 4)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
 
 if __name__ == "__main__":
     import sys
@@ -36,7 +36,7 @@ def binary_read_recursive_GetEventRequestPacket(meta: binary_io.PduMetaData, bin
     # data_type: struct 
     # member_name: body 
     # type_name: GetEventRequest 
-    # offset: 268 size: 128 
+    # offset: 268 size: 132 
     # array_len: 1
 
     tmp_py_obj = GetEventRequest()
@@ -90,7 +90,7 @@ def binary_write_recursive_GetEventRequestPacket(parent_off: int, bw_container:
     # data_type: struct 
     # member_name: body 
     # type_name: GetEventRequest 
-    # offset: 268 size: 128 
+    # offset: 268 size: 132 
     # array_len: 1
     type = "GetEventRequest"
     off = 268
@@ -0,0 +1,582 @@
+
+import struct
+from .pdu_pytype_GetServerStatsResponse import GetServerStatsResponse
+from ..pdu_utils import *
+from .. import binary_io
+
+# dependencies for the generated Python class
+
+
+
+def pdu_to_py_GetServerStatsResponse(binary_data: bytearray) -> GetServerStatsResponse:
+    py_obj = GetServerStatsResponse()
+    meta_parser = binary_io.PduMetaDataParser()
+    meta = meta_parser.load_pdu_meta(binary_data)
+    if meta is None:
+        raise ValueError("Invalid PDU binary data: MetaData not found or corrupted")
+    binary_read_recursive_GetServerStatsResponse(meta, binary_data, py_obj, binary_io.PduMetaData.PDU_META_DATA_SIZE)
+    return py_obj
+
+
+def binary_read_recursive_GetServerStatsResponse(meta: binary_io.PduMetaData, binary_data: bytearray, py_obj: GetServerStatsResponse, base_off: int):
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: service_name 
+    # type_name: string 
+    # offset: 0 size: 128 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 0, 128)
+    py_obj.service_name = binary_io.binTovalue("string", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: count 
+    # type_name: uint64 
+    # offset: 128 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 128, 8)
+    py_obj.count = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: rejected 
+    # type_name: uint64 
+    # offset: 136 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 136, 8)
+    py_obj.rejected = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_p50_usec 
+    # type_name: uint64 
+    # offset: 144 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 144, 8)
+    py_obj.queue_wait_p50_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_p99_usec 
+    # type_name: uint64 
+    # offset: 152 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 152, 8)
+    py_obj.queue_wait_p99_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_p999_usec 
+    # type_name: uint64 
+    # offset: 160 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 160, 8)
+    py_obj.queue_wait_p999_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_max_usec 
+    # type_name: uint64 
+    # offset: 168 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 168, 8)
+    py_obj.queue_wait_max_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_p50_usec 
+    # type_name: uint64 
+    # offset: 176 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 176, 8)
+    py_obj.handler_p50_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_p99_usec 
+    # type_name: uint64 
+    # offset: 184 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 184, 8)
+    py_obj.handler_p99_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_p999_usec 
+    # type_name: uint64 
+    # offset: 192 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 192, 8)
+    py_obj.handler_p999_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_max_usec 
+    # type_name: uint64 
+    # offset: 200 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 200, 8)
+    py_obj.handler_max_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_p50_usec 
+    # type_name: uint64 
+    # offset: 208 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 208, 8)
+    py_obj.reply_p50_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_p99_usec 
+    # type_name: uint64 
+    # offset: 216 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 216, 8)
+    py_obj.reply_p99_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_p999_usec 
+    # type_name: uint64 
+    # offset: 224 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 224, 8)
+    py_obj.reply_p999_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_max_usec 
+    # type_name: uint64 
+    # offset: 232 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 232, 8)
+    py_obj.reply_max_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_p50_usec 
+    # type_name: uint64 
+    # offset: 240 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 240, 8)
+    py_obj.total_p50_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_p99_usec 
+    # type_name: uint64 
+    # offset: 248 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 248, 8)
+    py_obj.total_p99_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_p999_usec 
+    # type_name: uint64 
+    # offset: 256 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 256, 8)
+    py_obj.total_p999_usec = binary_io.binTovalue("uint64", bin)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_max_usec 
+    # type_name: uint64 
+    # offset: 264 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 264, 8)
+    py_obj.total_max_usec = binary_io.binTovalue("uint64", bin)
+    
+    return py_obj
+
+
+def py_to_pdu_GetServerStatsResponse(py_obj: GetServerStatsResponse) -> bytearray:
+    binary_data = bytearray()
+    base_allocator = DynamicAllocator(False)
+    bw_container = BinaryWriterContainer(binary_io.PduMetaData())
+    binary_write_recursive_GetServerStatsResponse(0, bw_container, base_allocator, py_obj)
+
+    # メタデータの設定
+    total_size = base_allocator.size() + bw_container.heap_allocator.size() + binary_io.PduMetaData.PDU_META_DATA_SIZE
+    bw_container.meta.total_size = total_size
+    bw_container.meta.heap_off = binary_io.PduMetaData.PDU_META_DATA_SIZE + base_allocator.size()
+
+    # binary_data のサイズを total_size に調整
+    if len(binary_data) < total_size:
+        binary_data.extend(bytearray(total_size - len(binary_data)))
+    elif len(binary_data) > total_size:
+        del binary_data[total_size:]
+
+    # メタデータをバッファにコピー
+    binary_io.writeBinary(binary_data, 0, bw_container.meta.to_bytes())
+
+    # 基本データをバッファにコピー
+    binary_io.writeBinary(binary_data, bw_container.meta.base_off, base_allocator.to_array())
+
+    # ヒープデータをバッファにコピー
+    binary_io.writeBinary(binary_data, bw_container.meta.heap_off, bw_container.heap_allocator.to_array())
+
+    return binary_data
+
+def binary_write_recursive_GetServerStatsResponse(parent_off: int, bw_container: BinaryWriterContainer, allocator, py_obj: GetServerStatsResponse):
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: service_name 
+    # type_name: string 
+    # offset: 0 size: 128 
+    # array_len: 1
+    type = "string"
+    off = 0
+
+    
+    bin = binary_io.typeTobin(type, py_obj.service_name)
+    bin = get_binary(type, bin, 128)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: count 
+    # type_name: uint64 
+    # offset: 128 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 128
+
+    
+    bin = binary_io.typeTobin(type, py_obj.count)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: rejected 
+    # type_name: uint64 
+    # offset: 136 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 136
+
+    
+    bin = binary_io.typeTobin(type, py_obj.rejected)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_p50_usec 
+    # type_name: uint64 
+    # offset: 144 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 144
+
+    
+    bin = binary_io.typeTobin(type, py_obj.queue_wait_p50_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_p99_usec 
+    # type_name: uint64 
+    # offset: 152 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 152
+
+    
+    bin = binary_io.typeTobin(type, py_obj.queue_wait_p99_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_p999_usec 
+    # type_name: uint64 
+    # offset: 160 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 160
+
+    
+    bin = binary_io.typeTobin(type, py_obj.queue_wait_p999_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: queue_wait_max_usec 
+    # type_name: uint64 
+    # offset: 168 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 168
+
+    
+    bin = binary_io.typeTobin(type, py_obj.queue_wait_max_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_p50_usec 
+    # type_name: uint64 
+    # offset: 176 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 176
+
+    
+    bin = binary_io.typeTobin(type, py_obj.handler_p50_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_p99_usec 
+    # type_name: uint64 
+    # offset: 184 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 184
+
+    
+    bin = binary_io.typeTobin(type, py_obj.handler_p99_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_p999_usec 
+    # type_name: uint64 
+    # offset: 192 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 192
+
+    
+    bin = binary_io.typeTobin(type, py_obj.handler_p999_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: handler_max_usec 
+    # type_name: uint64 
+    # offset: 200 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 200
+
+    
+    bin = binary_io.typeTobin(type, py_obj.handler_max_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_p50_usec 
+    # type_name: uint64 
+    # offset: 208 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 208
+
+    
+    bin = binary_io.typeTobin(type, py_obj.reply_p50_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_p99_usec 
+    # type_name: uint64 
+    # offset: 216 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 216
+
+    
+    bin = binary_io.typeTobin(type, py_obj.reply_p99_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_p999_usec 
+    # type_name: uint64 
+    # offset: 224 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 224
+
+    
+    bin = binary_io.typeTobin(type, py_obj.reply_p999_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: reply_max_usec 
+    # type_name: uint64 
+    # offset: 232 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 232
+
+    
+    bin = binary_io.typeTobin(type, py_obj.reply_max_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_p50_usec 
+    # type_name: uint64 
+    # offset: 240 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 240
+
+    
+    bin = binary_io.typeTobin(type, py_obj.total_p50_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_p99_usec 
+    # type_name: uint64 
+    # offset: 248 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 248
+
+    
+    bin = binary_io.typeTobin(type, py_obj.total_p99_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_p999_usec 
+    # type_name: uint64 
+    # offset: 256 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 256
+
+    
+    bin = binary_io.typeTobin(type, py_obj.total_p999_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: total_max_usec 
+    # type_name: uint64 
+    # offset: 264 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 264
+
+    
+    bin = binary_io.typeTobin(type, py_obj.total_max_usec)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
+
+if __name__ == "__main__":
+    import sys
+    import json
+
+    def print_usage():
+        print(f"Usage: python -m pdu.python.pdu_conv_GetServerStatsResponse <read|write> [args...]")
+        print(f"  read <input_binary_file> <output_json_file>")
+        print(f"  write <input_json_file> <output_binary_file>")
+
+    if len(sys.argv) < 2:
+        print_usage()
+        sys.exit(1)
+
+    command = sys.argv[1]
+
+    if command == "read":
+        if len(sys.argv) != 4:
+            print_usage()
+            sys.exit(1)
+        
+        binary_filepath = sys.argv[2]
+        output_json_filepath = sys.argv[3]
+
+        with open(binary_filepath, "rb") as f:
+            binary_data = bytearray(f.read())
+        
+        py_obj = pdu_to_py_GetServerStatsResponse(binary_data)
+        
+        with open(output_json_filepath, "w") as f:
+            f.write(py_obj.to_json())
+
+    elif command == "write":
+        if len(sys.argv) != 4:
+            print_usage()
+            sys.exit(1)
+
+        input_json_filepath = sys.argv[2]
+        output_binary_filepath = sys.argv[3]
+
+        with open(input_json_filepath, "r") as f:
+            json_str = f.read()
+        
+        py_obj = GetServerStatsResponse.from_json(json_str)
+        
+        binary_data = py_to_pdu_GetServerStatsResponse(py_obj)
+
+        with open(output_binary_filepath, "wb") as f:
+            f.write(binary_data)
+
+    else:
+        print(f"Unknown command: {command}")
+        print_usage()
+        sys.exit(1)
@@ -30,6 +30,17 @@ def binary_read_recursive_JoinRequest(meta: binary_io.PduMetaData, binary_data:
     bin = binary_io.readBinary(binary_data, base_off + 0, 128)
     py_obj.name = binary_io.binTovalue("string", bin)
     
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: session_token 
+    # type_name: uint64 
+    # offset: 128 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 128, 8)
+    py_obj.session_token = binary_io.binTovalue("uint64", bin)
+    
     return py_obj
 
 
@@ -76,6 +87,20 @@ def binary_write_recursive_JoinRequest(parent_off: int, bw_container: BinaryWrit
     bin = get_binary(type, bin, 128)
     allocator.add(bin, expected_offset=parent_off + off)
     
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: session_token 
+    # type_name: uint64 
+    # offset: 128 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 128
+
+    
+    bin = binary_io.typeTobin(type, py_obj.session_token)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
 
 if __name__ == "__main__":
     import sys
@@ -36,11 +36,11 @@ def binary_read_recursive_JoinRequestPacket(meta: binary_io.PduMetaData, binary_
     # data_type: struct 
     # member_name: body 
     # type_name: JoinRequest 
-    # offset: 268 size: 128 
+    # offset: 272 size: 136 
     # array_len: 1
 
     tmp_py_obj = JoinRequest()
-    binary_read_recursive_JoinRequest(meta, binary_data, tmp_py_obj, base_off + 268)
+    binary_read_recursive_JoinRequest(meta, binary_data, tmp_py_obj, base_off + 272)
     py_obj.body = tmp_py_obj
     
     return py_obj
@@ -90,10 +90,10 @@ def binary_write_recursive_JoinRequestPacket(parent_off: int, bw_container: Bina
     # data_type: struct 
     # member_name: body 
     # type_name: JoinRequest 
-    # offset: 268 size: 128 
+    # offset: 272 size: 136 
     # array_len: 1
     type = "JoinRequest"
-    off = 268
+    off = 272
 
     binary_write_recursive_JoinRequest(parent_off + off, bw_container, allocator, py_obj.body)
     
@@ -41,6 +41,17 @@ def binary_read_recursive_JoinResponse(meta: binary_io.PduMetaData, binary_data:
     bin = binary_io.readBinary(binary_data, base_off + 4, 128)
     py_obj.message = binary_io.binTovalue("string", bin)
     
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: session_token 
+    # type_name: uint64 
+    # offset: 136 size: 8 
+    # array_len: 1
+
+    
+    bin = binary_io.readBinary(binary_data, base_off + 136, 8)
+    py_obj.session_token = binary_io.binTovalue("uint64", bin)
+    
     return py_obj
 
 
@@ -101,6 +112,20 @@ def binary_write_recursive_JoinResponse(parent_off: int, bw_container: BinaryWri
     bin = get_binary(type, bin, 128)
     allocator.add(bin, expected_offset=parent_off + off)
     
+    # array_type: single 
+    # data_type: primitive 
+    # member_name: session_token 
+    # type_name: uint64 
+    # offset: 136 size: 8 
+    # array_len: 1
+    type = "uint64"
+    off = 136
+
+    
+    bin = binary_io.typeTobin(type, py_obj.session_token)
+    bin = get_binary(type, bin, 8)
+    allocator.add(bin, expected_offset=parent_off + off)
+    
 
 if __name__ == "__main__":
     import sys
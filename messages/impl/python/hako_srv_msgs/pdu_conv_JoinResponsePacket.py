@@ -36,11 +36,11 @@ def binary_read_recursive_JoinResponsePacket(meta: binary_io.PduMetaData, binary
     # data_type: struct 
     # member_name: body 
     # type_name: JoinResponse 
-    # offset: 268 size: 132 
+    # offset: 272 size: 144 
     # array_len: 1
 
     tmp_py_obj = JoinResponse()
-    binary_read_recursive_JoinResponse(meta, binary_data, tmp_py_obj, base_off + 268)
+    binary_read_recursive_JoinResponse(meta, binary_data, tmp_py_obj, base_off + 272)
     py_obj.body = tmp_py_obj
     
     return py_obj
@@ -90,10 +90,10 @@ def binary_write_recursive_JoinResponsePacket(parent_off: int, bw_container: Bin
     # data_type: struct 
     # member_name: body 
     # type_name: JoinResponse 
-    # offset: 268 size: 132 
+    # offset: 272 size: 144 
     # array_len: 1
     type = "JoinResponse"
-    off = 268
+    off = 272
 
     binary_write_recursive_JoinResponse(parent_off + off, bw_container, allocator, py_obj.body)
     
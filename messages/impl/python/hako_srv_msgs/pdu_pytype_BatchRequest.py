@@ -0,0 +1,171 @@
+from typing import List
+
+# dependencies for the generated Python class
+
+
+# class definition for the ROS message
+class BatchRequest:
+    """
+    ROS message: hako_srv_msgs/BatchRequest
+    Generated by hakoniwa-ros2pdu.
+    """
+
+    name: str
+    op_count: int
+    ops: List[int]
+    args: List[int]
+
+    def __init__(self):
+        self.name = ""
+        self.op_count = 0
+        self.ops = []
+        self.args = []
+
+    def __str__(self):
+        return f"BatchRequest(" + ", ".join([
+            f"name={self.name}"
+            f"op_count={self.op_count}"
+            f"ops={self.ops}"
+            f"args={self.args}"
+        ]) + ")"
+
+    def __repr__(self):
+        return self.__str__()
+
+    def to_dict(self):
+        """
+        Convert the object to a dictionary.
+        """
+        d = {}
+        # handle field 'name'
+        field_val = self.name
+        if isinstance(field_val, bytearray):
+            d['name'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['name'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['name'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['name'] = field_val
+        # handle field 'op_count'
+        field_val = self.op_count
+        if isinstance(field_val, bytearray):
+            d['op_count'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['op_count'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['op_count'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['op_count'] = field_val
+        # handle field 'ops'
+        field_val = self.ops
+        if isinstance(field_val, bytearray):
+            d['ops'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['ops'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['ops'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['ops'] = field_val
+        # handle field 'args'
+        field_val = self.args
+        if isinstance(field_val, bytearray):
+            d['args'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['args'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['args'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['args'] = field_val
+        return d
+
+    @classmethod
+    def from_dict(cls, d: dict):
+        """
+        Create an object from a dictionary.
+        """
+        obj = cls()
+        # handle field 'name'
+        if 'name' in d:
+            field_type = cls.__annotations__.get('name')
+            value = d['name']
+            
+            if field_type is bytearray:
+                obj.name = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.name = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.name = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.name = field_type.from_dict(value)
+            else:
+                obj.name = value
+        # handle field 'op_count'
+        if 'op_count' in d:
+            field_type = cls.__annotations__.get('op_count')
+            value = d['op_count']
+            
+            if field_type is bytearray:
+                obj.op_count = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.op_count = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.op_count = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.op_count = field_type.from_dict(value)
+            else:
+                obj.op_count = value
+        # handle field 'ops'
+        if 'ops' in d:
+            field_type = cls.__annotations__.get('ops')
+            value = d['ops']
+            
+            if field_type is bytearray:
+                obj.ops = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.ops = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.ops = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.ops = field_type.from_dict(value)
+            else:
+                obj.ops = value
+        # handle field 'args'
+        if 'args' in d:
+            field_type = cls.__annotations__.get('args')
+            value = d['args']
+            
+            if field_type is bytearray:
+                obj.args = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.args = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.args = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.args = field_type.from_dict(value)
+            else:
+                obj.args = value
+        return obj
+
+    def to_json(self, indent=2):
+        """
+        Convert the object to a JSON string.
+        """
+        import json
+        return json.dumps(self.to_dict(), indent=indent)
+
+    @classmethod
+    def from_json(cls, json_str: str):
+        """
+        Create an object from a JSON string.
+        """
+        import json
+        return cls.from_dict(json.loads(json_str))
@@ -11,13 +11,16 @@ class GetEventRequest:
     """
 
     name: str
+    wait_timeout_msec: int
 
     def __init__(self):
         self.name = ""
+        self.wait_timeout_msec = 0
 
     def __str__(self):
         return f"GetEventRequest(" + ", ".join([
             f"name={self.name}"
+            f"wait_timeout_msec={self.wait_timeout_msec}"
         ]) + ")"
 
     def __repr__(self):
@@ -38,6 +41,16 @@ class GetEventRequest:
             d['name'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
         else:
             d['name'] = field_val
+        # handle field 'wait_timeout_msec'
+        field_val = self.wait_timeout_msec
+        if isinstance(field_val, bytearray):
+            d['wait_timeout_msec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['wait_timeout_msec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['wait_timeout_msec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['wait_timeout_msec'] = field_val
         return d
 
     @classmethod
@@ -63,6 +76,23 @@ class GetEventRequest:
                 obj.name = field_type.from_dict(value)
             else:
                 obj.name = value
+        # handle field 'wait_timeout_msec'
+        if 'wait_timeout_msec' in d:
+            field_type = cls.__annotations__.get('wait_timeout_msec')
+            value = d['wait_timeout_msec']
+            
+            if field_type is bytearray:
+                obj.wait_timeout_msec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.wait_timeout_msec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.wait_timeout_msec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.wait_timeout_msec = field_type.from_dict(value)
+            else:
+                obj.wait_timeout_msec = value
         return obj
 
     def to_json(self, indent=2):
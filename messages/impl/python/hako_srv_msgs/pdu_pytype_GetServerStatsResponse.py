@@ -0,0 +1,621 @@
+from typing import List
+
+# dependencies for the generated Python class
+
+
+# class definition for the ROS message
+class GetServerStatsResponse:
+    """
+    ROS message: hako_srv_msgs/GetServerStatsResponse
+    Generated by hakoniwa-ros2pdu.
+    """
+
+    service_name: str
+    count: int
+    rejected: int
+    queue_wait_p50_usec: int
+    queue_wait_p99_usec: int
+    queue_wait_p999_usec: int
+    queue_wait_max_usec: int
+    handler_p50_usec: int
+    handler_p99_usec: int
+    handler_p999_usec: int
+    handler_max_usec: int
+    reply_p50_usec: int
+    reply_p99_usec: int
+    reply_p999_usec: int
+    reply_max_usec: int
+    total_p50_usec: int
+    total_p99_usec: int
+    total_p999_usec: int
+    total_max_usec: int
+
+    def __init__(self):
+        self.service_name = ""
+        self.count = 0
+        self.rejected = 0
+        self.queue_wait_p50_usec = 0
+        self.queue_wait_p99_usec = 0
+        self.queue_wait_p999_usec = 0
+        self.queue_wait_max_usec = 0
+        self.handler_p50_usec = 0
+        self.handler_p99_usec = 0
+        self.handler_p999_usec = 0
+        self.handler_max_usec = 0
+        self.reply_p50_usec = 0
+        self.reply_p99_usec = 0
+        self.reply_p999_usec = 0
+        self.reply_max_usec = 0
+        self.total_p50_usec = 0
+        self.total_p99_usec = 0
+        self.total_p999_usec = 0
+        self.total_max_usec = 0
+
+    def __str__(self):
+        return f"GetServerStatsResponse(" + ", ".join([
+            f"service_name={self.service_name}"
+            f"count={self.count}"
+            f"rejected={self.rejected}"
+            f"queue_wait_p50_usec={self.queue_wait_p50_usec}"
+            f"queue_wait_p99_usec={self.queue_wait_p99_usec}"
+            f"queue_wait_p999_usec={self.queue_wait_p999_usec}"
+            f"queue_wait_max_usec={self.queue_wait_max_usec}"
+            f"handler_p50_usec={self.handler_p50_usec}"
+            f"handler_p99_usec={self.handler_p99_usec}"
+            f"handler_p999_usec={self.handler_p999_usec}"
+            f"handler_max_usec={self.handler_max_usec}"
+            f"reply_p50_usec={self.reply_p50_usec}"
+            f"reply_p99_usec={self.reply_p99_usec}"
+            f"reply_p999_usec={self.reply_p999_usec}"
+            f"reply_max_usec={self.reply_max_usec}"
+            f"total_p50_usec={self.total_p50_usec}"
+            f"total_p99_usec={self.total_p99_usec}"
+            f"total_p999_usec={self.total_p999_usec}"
+            f"total_max_usec={self.total_max_usec}"
+        ]) + ")"
+
+    def __repr__(self):
+        return self.__str__()
+
+    def to_dict(self):
+        """
+        Convert the object to a dictionary.
+        """
+        d = {}
+        # handle field 'service_name'
+        field_val = self.service_name
+        if isinstance(field_val, bytearray):
+            d['service_name'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['service_name'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['service_name'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['service_name'] = field_val
+        # handle field 'count'
+        field_val = self.count
+        if isinstance(field_val, bytearray):
+            d['count'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['count'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['count'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['count'] = field_val
+        # handle field 'rejected'
+        field_val = self.rejected
+        if isinstance(field_val, bytearray):
+            d['rejected'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['rejected'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['rejected'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['rejected'] = field_val
+        # handle field 'queue_wait_p50_usec'
+        field_val = self.queue_wait_p50_usec
+        if isinstance(field_val, bytearray):
+            d['queue_wait_p50_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['queue_wait_p50_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['queue_wait_p50_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['queue_wait_p50_usec'] = field_val
+        # handle field 'queue_wait_p99_usec'
+        field_val = self.queue_wait_p99_usec
+        if isinstance(field_val, bytearray):
+            d['queue_wait_p99_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['queue_wait_p99_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['queue_wait_p99_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['queue_wait_p99_usec'] = field_val
+        # handle field 'queue_wait_p999_usec'
+        field_val = self.queue_wait_p999_usec
+        if isinstance(field_val, bytearray):
+            d['queue_wait_p999_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['queue_wait_p999_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['queue_wait_p999_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['queue_wait_p999_usec'] = field_val
+        # handle field 'queue_wait_max_usec'
+        field_val = self.queue_wait_max_usec
+        if isinstance(field_val, bytearray):
+            d['queue_wait_max_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['queue_wait_max_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['queue_wait_max_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['queue_wait_max_usec'] = field_val
+        # handle field 'handler_p50_usec'
+        field_val = self.handler_p50_usec
+        if isinstance(field_val, bytearray):
+            d['handler_p50_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['handler_p50_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['handler_p50_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['handler_p50_usec'] = field_val
+        # handle field 'handler_p99_usec'
+        field_val = self.handler_p99_usec
+        if isinstance(field_val, bytearray):
+            d['handler_p99_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['handler_p99_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['handler_p99_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['handler_p99_usec'] = field_val
+        # handle field 'handler_p999_usec'
+        field_val = self.handler_p999_usec
+        if isinstance(field_val, bytearray):
+            d['handler_p999_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['handler_p999_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['handler_p999_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['handler_p999_usec'] = field_val
+        # handle field 'handler_max_usec'
+        field_val = self.handler_max_usec
+        if isinstance(field_val, bytearray):
+            d['handler_max_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['handler_max_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['handler_max_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['handler_max_usec'] = field_val
+        # handle field 'reply_p50_usec'
+        field_val = self.reply_p50_usec
+        if isinstance(field_val, bytearray):
+            d['reply_p50_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['reply_p50_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['reply_p50_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['reply_p50_usec'] = field_val
+        # handle field 'reply_p99_usec'
+        field_val = self.reply_p99_usec
+        if isinstance(field_val, bytearray):
+            d['reply_p99_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['reply_p99_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['reply_p99_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['reply_p99_usec'] = field_val
+        # handle field 'reply_p999_usec'
+        field_val = self.reply_p999_usec
+        if isinstance(field_val, bytearray):
+            d['reply_p999_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['reply_p999_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['reply_p999_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['reply_p999_usec'] = field_val
+        # handle field 'reply_max_usec'
+        field_val = self.reply_max_usec
+        if isinstance(field_val, bytearray):
+            d['reply_max_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['reply_max_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['reply_max_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['reply_max_usec'] = field_val
+        # handle field 'total_p50_usec'
+        field_val = self.total_p50_usec
+        if isinstance(field_val, bytearray):
+            d['total_p50_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['total_p50_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['total_p50_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['total_p50_usec'] = field_val
+        # handle field 'total_p99_usec'
+        field_val = self.total_p99_usec
+        if isinstance(field_val, bytearray):
+            d['total_p99_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['total_p99_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['total_p99_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['total_p99_usec'] = field_val
+        # handle field 'total_p999_usec'
+        field_val = self.total_p999_usec
+        if isinstance(field_val, bytearray):
+            d['total_p999_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['total_p999_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['total_p999_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['total_p999_usec'] = field_val
+        # handle field 'total_max_usec'
+        field_val = self.total_max_usec
+        if isinstance(field_val, bytearray):
+            d['total_max_usec'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['total_max_usec'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['total_max_usec'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['total_max_usec'] = field_val
+        return d
+
+    @classmethod
+    def from_dict(cls, d: dict):
+        """
+        Create an object from a dictionary.
+        """
+        obj = cls()
+        # handle field 'service_name'
+        if 'service_name' in d:
+            field_type = cls.__annotations__.get('service_name')
+            value = d['service_name']
+            
+            if field_type is bytearray:
+                obj.service_name = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.service_name = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.service_name = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.service_name = field_type.from_dict(value)
+            else:
+                obj.service_name = value
+        # handle field 'count'
+        if 'count' in d:
+            field_type = cls.__annotations__.get('count')
+            value = d['count']
+            
+            if field_type is bytearray:
+                obj.count = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.count = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.count = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.count = field_type.from_dict(value)
+            else:
+                obj.count = value
+        # handle field 'rejected'
+        if 'rejected' in d:
+            field_type = cls.__annotations__.get('rejected')
+            value = d['rejected']
+            
+            if field_type is bytearray:
+                obj.rejected = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.rejected = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.rejected = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.rejected = field_type.from_dict(value)
+            else:
+                obj.rejected = value
+        # handle field 'queue_wait_p50_usec'
+        if 'queue_wait_p50_usec' in d:
+            field_type = cls.__annotations__.get('queue_wait_p50_usec')
+            value = d['queue_wait_p50_usec']
+            
+            if field_type is bytearray:
+                obj.queue_wait_p50_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.queue_wait_p50_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.queue_wait_p50_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.queue_wait_p50_usec = field_type.from_dict(value)
+            else:
+                obj.queue_wait_p50_usec = value
+        # handle field 'queue_wait_p99_usec'
+        if 'queue_wait_p99_usec' in d:
+            field_type = cls.__annotations__.get('queue_wait_p99_usec')
+            value = d['queue_wait_p99_usec']
+            
+            if field_type is bytearray:
+                obj.queue_wait_p99_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.queue_wait_p99_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.queue_wait_p99_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.queue_wait_p99_usec = field_type.from_dict(value)
+            else:
+                obj.queue_wait_p99_usec = value
+        # handle field 'queue_wait_p999_usec'
+        if 'queue_wait_p999_usec' in d:
+            field_type = cls.__annotations__.get('queue_wait_p999_usec')
+            value = d['queue_wait_p999_usec']
+            
+            if field_type is bytearray:
+                obj.queue_wait_p999_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.queue_wait_p999_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.queue_wait_p999_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.queue_wait_p999_usec = field_type.from_dict(value)
+            else:
+                obj.queue_wait_p999_usec = value
+        # handle field 'queue_wait_max_usec'
+        if 'queue_wait_max_usec' in d:
+            field_type = cls.__annotations__.get('queue_wait_max_usec')
+            value = d['queue_wait_max_usec']
+            
+            if field_type is bytearray:
+                obj.queue_wait_max_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.queue_wait_max_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.queue_wait_max_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.queue_wait_max_usec = field_type.from_dict(value)
+            else:
+                obj.queue_wait_max_usec = value
+        # handle field 'handler_p50_usec'
+        if 'handler_p50_usec' in d:
+            field_type = cls.__annotations__.get('handler_p50_usec')
+            value = d['handler_p50_usec']
+            
+            if field_type is bytearray:
+                obj.handler_p50_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.handler_p50_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.handler_p50_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.handler_p50_usec = field_type.from_dict(value)
+            else:
+                obj.handler_p50_usec = value
+        # handle field 'handler_p99_usec'
+        if 'handler_p99_usec' in d:
+            field_type = cls.__annotations__.get('handler_p99_usec')
+            value = d['handler_p99_usec']
+            
+            if field_type is bytearray:
+                obj.handler_p99_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.handler_p99_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.handler_p99_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.handler_p99_usec = field_type.from_dict(value)
+            else:
+                obj.handler_p99_usec = value
+        # handle field 'handler_p999_usec'
+        if 'handler_p999_usec' in d:
+            field_type = cls.__annotations__.get('handler_p999_usec')
+            value = d['handler_p999_usec']
+            
+            if field_type is bytearray:
+                obj.handler_p999_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.handler_p999_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.handler_p999_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.handler_p999_usec = field_type.from_dict(value)
+            else:
+                obj.handler_p999_usec = value
+        # handle field 'handler_max_usec'
+        if 'handler_max_usec' in d:
+            field_type = cls.__annotations__.get('handler_max_usec')
+            value = d['handler_max_usec']
+            
+            if field_type is bytearray:
+                obj.handler_max_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.handler_max_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.handler_max_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.handler_max_usec = field_type.from_dict(value)
+            else:
+                obj.handler_max_usec = value
+        # handle field 'reply_p50_usec'
+        if 'reply_p50_usec' in d:
+            field_type = cls.__annotations__.get('reply_p50_usec')
+            value = d['reply_p50_usec']
+            
+            if field_type is bytearray:
+                obj.reply_p50_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.reply_p50_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.reply_p50_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.reply_p50_usec = field_type.from_dict(value)
+            else:
+                obj.reply_p50_usec = value
+        # handle field 'reply_p99_usec'
+        if 'reply_p99_usec' in d:
+            field_type = cls.__annotations__.get('reply_p99_usec')
+            value = d['reply_p99_usec']
+            
+            if field_type is bytearray:
+                obj.reply_p99_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.reply_p99_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.reply_p99_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.reply_p99_usec = field_type.from_dict(value)
+            else:
+                obj.reply_p99_usec = value
+        # handle field 'reply_p999_usec'
+        if 'reply_p999_usec' in d:
+            field_type = cls.__annotations__.get('reply_p999_usec')
+            value = d['reply_p999_usec']
+            
+            if field_type is bytearray:
+                obj.reply_p999_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.reply_p999_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.reply_p999_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.reply_p999_usec = field_type.from_dict(value)
+            else:
+                obj.reply_p999_usec = value
+        # handle field 'reply_max_usec'
+        if 'reply_max_usec' in d:
+            field_type = cls.__annotations__.get('reply_max_usec')
+            value = d['reply_max_usec']
+            
+            if field_type is bytearray:
+                obj.reply_max_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.reply_max_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.reply_max_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.reply_max_usec = field_type.from_dict(value)
+            else:
+                obj.reply_max_usec = value
+        # handle field 'total_p50_usec'
+        if 'total_p50_usec' in d:
+            field_type = cls.__annotations__.get('total_p50_usec')
+            value = d['total_p50_usec']
+            
+            if field_type is bytearray:
+                obj.total_p50_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.total_p50_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.total_p50_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.total_p50_usec = field_type.from_dict(value)
+            else:
+                obj.total_p50_usec = value
+        # handle field 'total_p99_usec'
+        if 'total_p99_usec' in d:
+            field_type = cls.__annotations__.get('total_p99_usec')
+            value = d['total_p99_usec']
+            
+            if field_type is bytearray:
+                obj.total_p99_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.total_p99_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.total_p99_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.total_p99_usec = field_type.from_dict(value)
+            else:
+                obj.total_p99_usec = value
+        # handle field 'total_p999_usec'
+        if 'total_p999_usec' in d:
+            field_type = cls.__annotations__.get('total_p999_usec')
+            value = d['total_p999_usec']
+            
+            if field_type is bytearray:
+                obj.total_p999_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.total_p999_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.total_p999_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.total_p999_usec = field_type.from_dict(value)
+            else:
+                obj.total_p999_usec = value
+        # handle field 'total_max_usec'
+        if 'total_max_usec' in d:
+            field_type = cls.__annotations__.get('total_max_usec')
+            value = d['total_max_usec']
+            
+            if field_type is bytearray:
+                obj.total_max_usec = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.total_max_usec = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.total_max_usec = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.total_max_usec = field_type.from_dict(value)
+            else:
+                obj.total_max_usec = value
+        return obj
+
+    def to_json(self, indent=2):
+        """
+        Convert the object to a JSON string.
+        """
+        import json
+        return json.dumps(self.to_dict(), indent=indent)
+
+    @classmethod
+    def from_json(cls, json_str: str):
+        """
+        Create an object from a JSON string.
+        """
+        import json
+        return cls.from_dict(json.loads(json_str))
@@ -12,15 +12,18 @@ class JoinResponse:
 
     status_code: int
     message: str
+    session_token: int
 
     def __init__(self):
         self.status_code = 0
         self.message = ""
+        self.session_token = 0
 
     def __str__(self):
         return f"JoinResponse(" + ", ".join([
             f"status_code={self.status_code}"
             f"message={self.message}"
+            f"session_token={self.session_token}"
         ]) + ")"
 
     def __repr__(self):
@@ -51,6 +54,16 @@ class JoinResponse:
             d['message'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
         else:
             d['message'] = field_val
+        # handle field 'session_token'
+        field_val = self.session_token
+        if isinstance(field_val, bytearray):
+            d['session_token'] = list(field_val)
+        elif hasattr(field_val, 'to_dict'):
+            d['session_token'] = field_val.to_dict()
+        elif isinstance(field_val, list):
+            d['session_token'] = [item.to_dict() if hasattr(item, 'to_dict') else item for item in field_val]
+        else:
+            d['session_token'] = field_val
         return d
 
     @classmethod
@@ -93,6 +106,23 @@ class JoinResponse:
                 obj.message = field_type.from_dict(value)
             else:
                 obj.message = value
+        # handle field 'session_token'
+        if 'session_token' in d:
+            field_type = cls.__annotations__.get('session_token')
+            value = d['session_token']
+            
+            if field_type is bytearray:
+                obj.session_token = bytearray(value)
+            elif hasattr(field_type, '__origin__') and field_type.__origin__ is list:
+                list_item_type = field_type.__args__[0]
+                if hasattr(list_item_type, 'from_dict'):
+                    obj.session_token = [list_item_type.from_dict(item) for item in value]
+                else:
+                    obj.session_token = value
+            elif hasattr(field_type, 'from_dict'):
+                obj.session_token = field_type.from_dict(value)
+            else:
+                obj.session_token = value
         return obj
 
     def to_json(self, indent=2):
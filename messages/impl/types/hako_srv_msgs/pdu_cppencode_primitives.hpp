@@ -0,0 +1,96 @@
+#ifndef _PDU_CPPENCODE_HAKO_hako_srv_msgs_primitives_HPP_
+#define _PDU_CPPENCODE_HAKO_hako_srv_msgs_primitives_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*
+ * In-place encoding used by the cpp2pdu() of the pdu_cpptype_conv_* classes:
+ * metadata and base data are written straight into the caller's pdu_buffer
+ * instead of into a hako_create_empty_pdu() allocation that is then copied.
+ * The layout-driven converters reject variable-length fields, so there is no
+ * heap section to write.
+ */
+
+// Metadata bytes in front of the base data of an empty T PDU, captured once
+// from hako_create_empty_pdu() so the layout stays the library's.
+template <typename T>
+struct HakoPduEncodeLayout {
+    bool valid{false};
+    size_t base_off{0};
+    std::vector<char> head;
+};
+
+template <typename T>
+static inline const HakoPduEncodeLayout<T>& hako_cppencode_layout()
+{
+    static const HakoPduEncodeLayout<T> layout = [] {
+        HakoPduEncodeLayout<T> l;
+        char* base_ptr = (char*)hako_create_empty_pdu(sizeof(T), 0);
+        if (base_ptr == nullptr) {
+            return l;
+        }
+        char* top_ptr = (char*)hako_get_top_ptr_pdu((void*)base_ptr);
+        if (top_ptr != nullptr && top_ptr <= base_ptr) {
+            l.base_off = (size_t)(base_ptr - top_ptr);
+            l.head.assign(top_ptr, base_ptr);
+            l.valid = true;
+        }
+        hako_destroy_pdu((void*)base_ptr);
+        return l;
+    }();
+    return layout;
+}
+
+// Whether T can be built in place at its base offset in pdu_buffer.
+template <typename T>
+static inline bool hako_cppencode_is_aligned(const char* pdu_buffer)
+{
+    const auto& layout = hako_cppencode_layout<T>();
+    return layout.valid && pdu_buffer != nullptr &&
+           ((uintptr_t)(pdu_buffer + layout.base_off) % alignof(T)) == 0;
+}
+
+// Size of an encoded T PDU: metadata and base data; 0 if the layout is unknown.
+template <typename T>
+static inline size_t hako_cppencode_pdu_size()
+{
+    const auto& layout = hako_cppencode_layout<T>();
+    return layout.valid ? layout.base_off + sizeof(T) : 0;
+}
+
+// Convert src into pdu_buffer in place. Returns the PDU size, or -1 if the
+// conversion fails or the PDU does not fit in buffer_len bytes.
+template <typename T, typename CppT, typename Convert>
+static inline int hako_cppencode_in_place(CppT& src, char* pdu_buffer, int buffer_len, Convert convert)
+{
+    const auto& layout = hako_cppencode_layout<T>();
+    size_t pdu_size = hako_cppencode_pdu_size<T>();
+    if (!hako_cppencode_is_aligned<T>(pdu_buffer) || buffer_len < 0 ||
+        (size_t)buffer_len < pdu_size) {
+        return -1;
+    }
+    char* base_ptr = pdu_buffer + layout.base_off;
+    memset(base_ptr, 0, sizeof(T));
+    if (!convert(src, *(T*)base_ptr)) {
+        return -1;
+    }
+    memcpy(pdu_buffer, layout.head.data(), layout.base_off);
+    return (int)pdu_size;
+}
+
+// The calling thread's 8-byte aligned staging buffer for encodes into a
+// misaligned pdu_buffer. It only grows, so it stops allocating once warm.
+static inline char* hako_cppencode_scratch(size_t size)
+{
+    thread_local std::vector<uint64_t> scratch;
+    if (scratch.size() * sizeof(uint64_t) < size) {
+        scratch.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    }
+    return (char*)scratch.data();
+}
+
+#endif /* _PDU_CPPENCODE_HAKO_hako_srv_msgs_primitives_HPP_ */
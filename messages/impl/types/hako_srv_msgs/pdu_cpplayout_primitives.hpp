@@ -0,0 +1,257 @@
+#ifndef _PDU_CPPLAYOUT_HAKO_hako_srv_msgs_primitives_HPP_
+#define _PDU_CPPLAYOUT_HAKO_hako_srv_msgs_primitives_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "hako_srv_msgs/pdu_cppencode_primitives.hpp"
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Layout-driven conversion for the pdu_cpptype_conv_* headers. Each message
+ * header specializes HakoPduLayout<Hako_X> with its name, its C++ type and a
+ * tuple of field descriptors (the member in Hako_X and the member in
+ * HakoCpp_X), generated from messages/impl/offset together with static_asserts
+ * that the C struct matches the offsets. The templates below walk that tuple;
+ * how a field is converted follows from its member types:
+ *
+ *   char[N]          <-> std::string         NUL-terminated string
+ *   E[N]             <-> std::array<C, N>    element-wise
+ *   described struct <-> its HakoCpp_ type   recursively
+ *   primitive        <-> primitive           hako_convert_pdu2cpp/cpp2pdu
+ *
+ * Variable-length fields (std::vector) are a compile error: a layout has no
+ * heap section, which is what lets every encode run in place.
+ */
+
+template <typename T>
+struct HakoPduLayout;
+
+template <typename PduT, typename CppT, typename PduM, typename CppM>
+struct HakoPduField {
+    PduM PduT::* pdu;
+    CppM CppT::* cpp;
+};
+
+template <typename PduT, typename CppT, typename PduM, typename CppM>
+constexpr HakoPduField<PduT, CppT, PduM, CppM> hako_pdu_field(PduM PduT::* pdu, CppM CppT::* cpp)
+{
+    return { pdu, cpp };
+}
+
+template <typename T>
+concept HakoPduDescribed = requires { HakoPduLayout<T>::fields; };
+
+template <typename T>
+struct hako_cpplayout_is_std_array : std::false_type {};
+template <typename T, size_t N>
+struct hako_cpplayout_is_std_array<std::array<T, N>> : std::true_type {};
+
+template <typename T>
+struct hako_cpplayout_is_std_vector : std::false_type {};
+template <typename T, typename A>
+struct hako_cpplayout_is_std_vector<std::vector<T, A>> : std::true_type {};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+template <typename PduT, typename CppT>
+static inline int hako_cpplayout_pdu2cpp(const char* heap_ptr, const PduT& src, CppT& dst);
+
+template <typename PduM, typename CppM>
+static inline void hako_cpplayout_value_pdu2cpp(const char* heap_ptr, const PduM& src, CppM& dst)
+{
+    static_assert(!hako_cpplayout_is_std_vector<CppM>::value, "variable-length fields are not supported");
+    if constexpr (std::is_same_v<CppM, std::string>) {
+        static_assert(std::is_same_v<std::remove_extent_t<PduM>, char>, "string field must be char[N] in the PDU");
+        dst.assign(src, strnlen(src, std::extent_v<PduM>));
+    }
+    else if constexpr (std::is_array_v<PduM>) {
+        static_assert(hako_cpplayout_is_std_array<CppM>::value && std::tuple_size_v<CppM> == std::extent_v<PduM>,
+                      "fixed array field must be std::array of the same length");
+        for (size_t i = 0; i < std::extent_v<PduM>; ++i) {
+            hako_cpplayout_value_pdu2cpp(heap_ptr, src[i], dst[i]);
+        }
+    }
+    else if constexpr (HakoPduDescribed<PduM>) {
+        (void)hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+    }
+    else {
+        static_assert(std::is_arithmetic_v<PduM>, "no conversion for this field type");
+        hako_convert_pdu2cpp(src, dst);
+    }
+}
+
+template <typename PduT, typename CppT>
+static inline int hako_cpplayout_pdu2cpp(const char* heap_ptr, const PduT& src, CppT& dst)
+{
+    std::apply([&](const auto&... field) {
+        (hako_cpplayout_value_pdu2cpp(heap_ptr, src.*(field.pdu), dst.*(field.cpp)), ...);
+    }, HakoPduLayout<PduT>::fields);
+    return 0;
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+template <typename PduT, typename CppT>
+static inline bool hako_cpplayout_cpp2pdu(const CppT& src, PduT& dst);
+
+template <typename PduM, typename CppM>
+static inline bool hako_cpplayout_value_cpp2pdu(const CppM& src, PduM& dst)
+{
+    static_assert(!hako_cpplayout_is_std_vector<CppM>::value, "variable-length fields are not supported");
+    if constexpr (std::is_same_v<CppM, std::string>) {
+        if (src.length() >= std::extent_v<PduM>) {
+            std::cerr << "convertor error: string of length " << src.length()
+                      << " does not fit in char[" << std::extent_v<PduM> << "]" << std::endl;
+            return false;
+        }
+        memcpy(dst, src.data(), src.length());
+        dst[src.length()] = '\0';
+        return true;
+    }
+    else if constexpr (std::is_array_v<PduM>) {
+        for (size_t i = 0; i < std::extent_v<PduM>; ++i) {
+            if (!hako_cpplayout_value_cpp2pdu(src[i], dst[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    else if constexpr (HakoPduDescribed<PduM>) {
+        return hako_cpplayout_cpp2pdu(src, dst);
+    }
+    else {
+        static_assert(std::is_arithmetic_v<PduM>, "no conversion for this field type");
+        hako_convert_cpp2pdu(src, dst);
+        return true;
+    }
+}
+
+template <typename PduT, typename CppT>
+static inline bool hako_cpplayout_cpp2pdu(const CppT& src, PduT& dst)
+{
+    return std::apply([&](const auto&... field) {
+        return (hako_cpplayout_value_cpp2pdu(src.*(field.cpp), dst.*(field.pdu)) && ...);
+    }, HakoPduLayout<PduT>::fields);
+}
+
+/***************************
+ *
+ * Whole PDU
+ *
+ ***************************/
+
+template <typename PduT>
+static inline int hako_cpplayout_convert_pdu2cpp(PduT& src, typename HakoPduLayout<PduT>::cpp_type& dst)
+{
+    void* heap_ptr = hako_get_heap_ptr_pdu((void*)&src);
+    if (heap_ptr == nullptr) {
+        return -1; // Invalid PDU metadata
+    }
+    return hako_cpplayout_pdu2cpp((const char*)heap_ptr, src, dst);
+}
+
+// Returns a PDU the caller frees with hako_destroy_pdu(), encoded in place
+// into that allocation.
+template <typename PduT>
+static inline int hako_cpplayout_convert_cpp2pdu(typename HakoPduLayout<PduT>::cpp_type& src, PduT** dst)
+{
+    using CppT = typename HakoPduLayout<PduT>::cpp_type;
+    void* base_ptr = hako_create_empty_pdu(sizeof(PduT), 0);
+    if (base_ptr == nullptr) {
+        return -1;
+    }
+    char* top_ptr = (char*)hako_get_top_ptr_pdu(base_ptr);
+    int pdu_size = hako_cppencode_in_place<PduT>(src, top_ptr, (int)hako_cppencode_pdu_size<PduT>(),
+                                                 hako_cpplayout_cpp2pdu<PduT, CppT>);
+    if (pdu_size < 0) {
+        hako_destroy_pdu(base_ptr);
+        return -1;
+    }
+    *dst = (PduT*)base_ptr;
+    return pdu_size;
+}
+
+/*
+ * pdu2cpp()/cpp2pdu() of the hako::pdu::msgs::hako_srv_msgs convertor
+ * classes, which derive from this with their Hako_ type.
+ */
+template <typename PduT>
+class HakoPduLayoutConvertor
+{
+public:
+    using CppT = typename HakoPduLayout<PduT>::cpp_type;
+
+    bool pdu2cpp(char* top_ptr, CppT& cppData)
+    {
+        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
+        if (base_ptr == nullptr) {
+            error() << "hako_get_base_ptr_pdu returned null" << std::endl;
+            return false;
+        }
+        int ret = hako_cpplayout_convert_pdu2cpp(*(PduT*)base_ptr, cppData);
+        if (ret != 0) {
+            error() << "hako_convert_pdu2cpp returned " << ret << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    int cpp2pdu(CppT& cppData, char* pdu_buffer, int buffer_len)
+    {
+        if (hako_cppencode_is_aligned<PduT>(pdu_buffer)) {
+            int pdu_size = hako_cppencode_in_place<PduT>(cppData, pdu_buffer, buffer_len,
+                hako_cpplayout_cpp2pdu<PduT, CppT>);
+            if (pdu_size < 0) {
+                error() << "in-place encode failed. buffer_len=" << buffer_len << std::endl;
+            }
+            return pdu_size;
+        }
+        return cpp2pdu_copy(cppData, pdu_buffer, buffer_len);
+    }
+
+private:
+    static std::ostream& error()
+    {
+        return std::cerr << "[ConvertorError][" << HakoPduLayout<PduT>::name << "] ";
+    }
+
+    // Misaligned pdu_buffer: encode into the thread's aligned scratch buffer and copy it.
+    int cpp2pdu_copy(CppT& cppData, char* pdu_buffer, int buffer_len)
+    {
+        size_t need = hako_cppencode_pdu_size<PduT>();
+        if (need == 0 || pdu_buffer == nullptr) {
+            error() << "no PDU layout to encode into" << std::endl;
+            return -1;
+        }
+        if (buffer_len < 0 || (size_t)buffer_len < need) {
+            error() << "buffer too small. pdu_size=" << need << " buffer_len=" << buffer_len << std::endl;
+            return -1;
+        }
+        char* scratch = hako_cppencode_scratch(need);
+        int pdu_size = hako_cppencode_in_place<PduT>(cppData, scratch, (int)need,
+            hako_cpplayout_cpp2pdu<PduT, CppT>);
+        if (pdu_size < 0) {
+            error() << "in-place encode failed. buffer_len=" << buffer_len << std::endl;
+            return -1;
+        }
+        memcpy(pdu_buffer, scratch, pdu_size);
+        return pdu_size;
+    }
+};
+
+#endif /* _PDU_CPPLAYOUT_HAKO_hako_srv_msgs_primitives_HPP_ */
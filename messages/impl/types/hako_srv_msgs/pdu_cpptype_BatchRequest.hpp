@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_BatchRequest_HPP_
+#define _pdu_cpptype_hako_srv_msgs_BatchRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+
+typedef struct {
+        std::string name;
+        Hako_uint32 op_count;
+        std::array<Hako_uint32, 8> ops;
+        std::array<Hako_uint32, 8> args;
+} HakoCpp_BatchRequest;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_BatchRequest_HPP_ */
@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_BatchRequestPacket_HPP_
+#define _pdu_cpptype_hako_srv_msgs_BatchRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+#include "hako_srv_msgs/pdu_cpptype_BatchRequest.hpp"
+#include "hako_srv_msgs/pdu_cpptype_ServiceRequestHeader.hpp"
+
+typedef struct {
+        HakoCpp_ServiceRequestHeader header;
+        HakoCpp_BatchRequest body;
+} HakoCpp_BatchRequestPacket;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_BatchRequestPacket_HPP_ */
@@ -0,0 +1,18 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_BatchResponse_HPP_
+#define _pdu_cpptype_hako_srv_msgs_BatchResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+
+typedef struct {
+        Hako_uint32 op_count;
+        std::array<Hako_int32, 8> result_codes;
+        std::array<Hako_uint32, 8> values;
+        Hako_int64 master_time;
+        Hako_bool is_pdu_created;
+        Hako_bool is_simulation_mode;
+        Hako_bool is_pdu_sync_mode;
+} HakoCpp_BatchResponse;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_BatchResponse_HPP_ */
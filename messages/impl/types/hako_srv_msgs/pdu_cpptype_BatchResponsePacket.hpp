@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_BatchResponsePacket_HPP_
+#define _pdu_cpptype_hako_srv_msgs_BatchResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+#include "hako_srv_msgs/pdu_cpptype_BatchResponse.hpp"
+#include "hako_srv_msgs/pdu_cpptype_ServiceResponseHeader.hpp"
+
+typedef struct {
+        HakoCpp_ServiceResponseHeader header;
+        HakoCpp_BatchResponse body;
+} HakoCpp_BatchResponsePacket;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_BatchResponsePacket_HPP_ */
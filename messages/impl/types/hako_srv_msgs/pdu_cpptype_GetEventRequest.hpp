@@ -7,6 +7,7 @@
 
 typedef struct {
         std::string name;
+        Hako_uint32 wait_timeout_msec;
 } HakoCpp_GetEventRequest;
 
 #endif /* _pdu_cpptype_hako_srv_msgs_GetEventRequest_HPP_ */
@@ -0,0 +1,13 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_GetServerStatsRequest_HPP_
+#define _pdu_cpptype_hako_srv_msgs_GetServerStatsRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+
+typedef struct {
+        std::string name;
+        std::string service_name;
+} HakoCpp_GetServerStatsRequest;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_GetServerStatsRequest_HPP_ */
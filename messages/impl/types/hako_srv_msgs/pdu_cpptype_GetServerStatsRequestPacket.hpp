@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_GetServerStatsRequestPacket_HPP_
+#define _pdu_cpptype_hako_srv_msgs_GetServerStatsRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+#include "hako_srv_msgs/pdu_cpptype_GetServerStatsRequest.hpp"
+#include "hako_srv_msgs/pdu_cpptype_ServiceRequestHeader.hpp"
+
+typedef struct {
+        HakoCpp_ServiceRequestHeader header;
+        HakoCpp_GetServerStatsRequest body;
+} HakoCpp_GetServerStatsRequestPacket;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_GetServerStatsRequestPacket_HPP_ */
@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_GetServerStatsResponsePacket_HPP_
+#define _pdu_cpptype_hako_srv_msgs_GetServerStatsResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+#include "hako_srv_msgs/pdu_cpptype_GetServerStatsResponse.hpp"
+#include "hako_srv_msgs/pdu_cpptype_ServiceResponseHeader.hpp"
+
+typedef struct {
+        HakoCpp_ServiceResponseHeader header;
+        HakoCpp_GetServerStatsResponse body;
+} HakoCpp_GetServerStatsResponsePacket;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_GetServerStatsResponsePacket_HPP_ */
@@ -7,6 +7,7 @@
 
 typedef struct {
         std::string name;
+        Hako_uint64 session_token;
 } HakoCpp_JoinRequest;
 
 #endif /* _pdu_cpptype_hako_srv_msgs_JoinRequest_HPP_ */
@@ -8,6 +8,7 @@
 typedef struct {
         Hako_uint32 status_code;
         std::string message;
+        Hako_uint64 session_token;
 } HakoCpp_JoinResponse;
 
 #endif /* _pdu_cpptype_hako_srv_msgs_JoinResponse_HPP_ */
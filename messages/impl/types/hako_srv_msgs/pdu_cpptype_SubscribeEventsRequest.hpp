@@ -0,0 +1,12 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_SubscribeEventsRequest_HPP_
+#define _pdu_cpptype_hako_srv_msgs_SubscribeEventsRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+
+typedef struct {
+        std::string name;
+} HakoCpp_SubscribeEventsRequest;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_SubscribeEventsRequest_HPP_ */
@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_
+#define _pdu_cpptype_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+#include "hako_srv_msgs/pdu_cpptype_ServiceRequestHeader.hpp"
+#include "hako_srv_msgs/pdu_cpptype_SubscribeEventsRequest.hpp"
+
+typedef struct {
+        HakoCpp_ServiceRequestHeader header;
+        HakoCpp_SubscribeEventsRequest body;
+} HakoCpp_SubscribeEventsRequestPacket;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_ */
@@ -0,0 +1,12 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_SubscribeEventsResponse_HPP_
+#define _pdu_cpptype_hako_srv_msgs_SubscribeEventsResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+
+typedef struct {
+        Hako_uint32 event_code;
+} HakoCpp_SubscribeEventsResponse;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_SubscribeEventsResponse_HPP_ */
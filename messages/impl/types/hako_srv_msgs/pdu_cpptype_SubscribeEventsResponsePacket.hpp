@@ -0,0 +1,15 @@
+#ifndef _pdu_cpptype_hako_srv_msgs_SubscribeEventsResponsePacket_HPP_
+#define _pdu_cpptype_hako_srv_msgs_SubscribeEventsResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <vector>
+#include <array>
+#include "hako_srv_msgs/pdu_cpptype_ServiceResponseHeader.hpp"
+#include "hako_srv_msgs/pdu_cpptype_SubscribeEventsResponse.hpp"
+
+typedef struct {
+        HakoCpp_ServiceResponseHeader header;
+        HakoCpp_SubscribeEventsResponse body;
+} HakoCpp_SubscribeEventsResponsePacket;
+
+#endif /* _pdu_cpptype_hako_srv_msgs_SubscribeEventsResponsePacket_HPP_ */
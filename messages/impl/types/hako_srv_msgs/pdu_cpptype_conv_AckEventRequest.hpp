@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,31 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/AckEventRequest.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_AckEventRequest) == 136, "Hako_AckEventRequest size does not match AckEventRequest.offset");
+static_assert(offsetof(Hako_AckEventRequest, name) == 0 && sizeof(Hako_AckEventRequest::name) == 128,
+              "Hako_AckEventRequest::name does not match AckEventRequest.offset");
+static_assert(offsetof(Hako_AckEventRequest, event_code) == 128 && sizeof(Hako_AckEventRequest::event_code) == 4,
+              "Hako_AckEventRequest::event_code does not match AckEventRequest.offset");
+static_assert(offsetof(Hako_AckEventRequest, result_code) == 132 && sizeof(Hako_AckEventRequest::result_code) == 4,
+              "Hako_AckEventRequest::result_code does not match AckEventRequest.offset");
+
+template <>
+struct HakoPduLayout<Hako_AckEventRequest> {
+    using cpp_type = HakoCpp_AckEventRequest;
+    static constexpr const char* name = "AckEventRequest";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_AckEventRequest::name, &HakoCpp_AckEventRequest::name),
+        hako_pdu_field(&Hako_AckEventRequest::event_code, &HakoCpp_AckEventRequest::event_code),
+        hako_pdu_field(&Hako_AckEventRequest::result_code, &HakoCpp_AckEventRequest::result_code)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,27 +51,12 @@
 
 static inline int cpp_pdu2cpp_AckEventRequest(const char* heap_ptr, Hako_AckEventRequest &src, HakoCpp_AckEventRequest &dst)
 {
-    // string convertor
-    dst.name = (const char*)src.name;
-    // primitive convert
-    hako_convert_pdu2cpp(src.event_code, dst.event_code);
-    // primitive convert
-    hako_convert_pdu2cpp(src.result_code, dst.result_code);
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_AckEventRequest(Hako_AckEventRequest &src, HakoCpp_AckEventRequest &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_AckEventRequest((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -56,104 +67,25 @@ static inline int hako_convert_pdu2cpp_AckEventRequest(Hako_AckEventRequest &src
 
 static inline bool cpp_cpp2pdu_AckEventRequest(HakoCpp_AckEventRequest &src, Hako_AckEventRequest &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // string convertor
-        (void)hako_convert_cpp2pdu_array(
-            src.name, src.name.length(),
-            dst.name, M_ARRAY_SIZE(Hako_AckEventRequest, char, name));
-        dst.name[src.name.length()] = '\0';
-        // primitive convert
-        hako_convert_cpp2pdu(src.event_code, dst.event_code);
-        // primitive convert
-        hako_convert_cpp2pdu(src.result_code, dst.result_code);
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_AckEventRequest(HakoCpp_AckEventRequest &src, Hako_AckEventRequest** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_AckEventRequest out;
-    if (!cpp_cpp2pdu_AckEventRequest(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_AckEventRequest), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_AckEventRequest));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_AckEventRequest*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_AckEventRequest* hako_create_empty_pdu_AckEventRequest(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_AckEventRequest), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_AckEventRequest*)base_ptr;
+    return (Hako_AckEventRequest*)hako_create_empty_pdu(sizeof(Hako_AckEventRequest), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class AckEventRequest
+class AckEventRequest : public HakoPduLayoutConvertor<Hako_AckEventRequest>
 {
-public:
-    AckEventRequest() = default;
-    ~AckEventRequest() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_AckEventRequest& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "AckEventRequest" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_AckEventRequest(*(Hako_AckEventRequest*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "AckEventRequest" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_AckEventRequest& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_AckEventRequest(cppData, (Hako_AckEventRequest**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "AckEventRequest" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "AckEventRequest" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "AckEventRequest" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_AckEventRequest_HPP_ */
@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,25 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/AckEventResponse.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_AckEventResponse) == 4, "Hako_AckEventResponse size does not match AckEventResponse.offset");
+static_assert(offsetof(Hako_AckEventResponse, ack_code) == 0 && sizeof(Hako_AckEventResponse::ack_code) == 4,
+              "Hako_AckEventResponse::ack_code does not match AckEventResponse.offset");
+
+template <>
+struct HakoPduLayout<Hako_AckEventResponse> {
+    using cpp_type = HakoCpp_AckEventResponse;
+    static constexpr const char* name = "AckEventResponse";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_AckEventResponse::ack_code, &HakoCpp_AckEventResponse::ack_code)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,23 +45,12 @@
 
 static inline int cpp_pdu2cpp_AckEventResponse(const char* heap_ptr, Hako_AckEventResponse &src, HakoCpp_AckEventResponse &dst)
 {
-    // primitive convert
-    hako_convert_pdu2cpp(src.ack_code, dst.ack_code);
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_AckEventResponse(Hako_AckEventResponse &src, HakoCpp_AckEventResponse &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_AckEventResponse((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -52,97 +61,25 @@ static inline int hako_convert_pdu2cpp_AckEventResponse(Hako_AckEventResponse &s
 
 static inline bool cpp_cpp2pdu_AckEventResponse(HakoCpp_AckEventResponse &src, Hako_AckEventResponse &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // primitive convert
-        hako_convert_cpp2pdu(src.ack_code, dst.ack_code);
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_AckEventResponse(HakoCpp_AckEventResponse &src, Hako_AckEventResponse** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_AckEventResponse out;
-    if (!cpp_cpp2pdu_AckEventResponse(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_AckEventResponse), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_AckEventResponse));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_AckEventResponse*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_AckEventResponse* hako_create_empty_pdu_AckEventResponse(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_AckEventResponse), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_AckEventResponse*)base_ptr;
+    return (Hako_AckEventResponse*)hako_create_empty_pdu(sizeof(Hako_AckEventResponse), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class AckEventResponse
+class AckEventResponse : public HakoPduLayoutConvertor<Hako_AckEventResponse>
 {
-public:
-    AckEventResponse() = default;
-    ~AckEventResponse() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_AckEventResponse& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "AckEventResponse" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_AckEventResponse(*(Hako_AckEventResponse*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "AckEventResponse" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_AckEventResponse& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_AckEventResponse(cppData, (Hako_AckEventResponse**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "AckEventResponse" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "AckEventResponse" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "AckEventResponse" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_AckEventResponse_HPP_ */
@@ -0,0 +1,94 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchRequest_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchRequest.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_BatchRequest.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/BatchRequest.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_BatchRequest) == 196, "Hako_BatchRequest size does not match BatchRequest.offset");
+static_assert(offsetof(Hako_BatchRequest, name) == 0 && sizeof(Hako_BatchRequest::name) == 128,
+              "Hako_BatchRequest::name does not match BatchRequest.offset");
+static_assert(offsetof(Hako_BatchRequest, op_count) == 128 && sizeof(Hako_BatchRequest::op_count) == 4,
+              "Hako_BatchRequest::op_count does not match BatchRequest.offset");
+static_assert(offsetof(Hako_BatchRequest, ops) == 132 && sizeof(Hako_BatchRequest::ops) == 32,
+              "Hako_BatchRequest::ops does not match BatchRequest.offset");
+static_assert(offsetof(Hako_BatchRequest, args) == 164 && sizeof(Hako_BatchRequest::args) == 32,
+              "Hako_BatchRequest::args does not match BatchRequest.offset");
+
+template <>
+struct HakoPduLayout<Hako_BatchRequest> {
+    using cpp_type = HakoCpp_BatchRequest;
+    static constexpr const char* name = "BatchRequest";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_BatchRequest::name, &HakoCpp_BatchRequest::name),
+        hako_pdu_field(&Hako_BatchRequest::op_count, &HakoCpp_BatchRequest::op_count),
+        hako_pdu_field(&Hako_BatchRequest::ops, &HakoCpp_BatchRequest::ops),
+        hako_pdu_field(&Hako_BatchRequest::args, &HakoCpp_BatchRequest::args)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_BatchRequest(const char* heap_ptr, Hako_BatchRequest &src, HakoCpp_BatchRequest &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_BatchRequest(Hako_BatchRequest &src, HakoCpp_BatchRequest &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_BatchRequest(HakoCpp_BatchRequest &src, Hako_BatchRequest &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_BatchRequest(HakoCpp_BatchRequest &src, Hako_BatchRequest** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_BatchRequest* hako_create_empty_pdu_BatchRequest(int heap_size)
+{
+    return (Hako_BatchRequest*)hako_create_empty_pdu(sizeof(Hako_BatchRequest), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class BatchRequest : public HakoPduLayoutConvertor<Hako_BatchRequest>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchRequest_HPP_ */
@@ -0,0 +1,90 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchRequestPacket_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchRequestPacket.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_BatchRequestPacket.hpp"
+
+/*
+ * Dependent Convertors
+ */
+#include "hako_srv_msgs/pdu_cpptype_conv_BatchRequest.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_ServiceRequestHeader.hpp"
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/BatchRequestPacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_BatchRequestPacket) == 464, "Hako_BatchRequestPacket size does not match BatchRequestPacket.offset");
+static_assert(offsetof(Hako_BatchRequestPacket, header) == 0 && sizeof(Hako_BatchRequestPacket::header) == 268,
+              "Hako_BatchRequestPacket::header does not match BatchRequestPacket.offset");
+static_assert(offsetof(Hako_BatchRequestPacket, body) == 268 && sizeof(Hako_BatchRequestPacket::body) == 196,
+              "Hako_BatchRequestPacket::body does not match BatchRequestPacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_BatchRequestPacket> {
+    using cpp_type = HakoCpp_BatchRequestPacket;
+    static constexpr const char* name = "BatchRequestPacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_BatchRequestPacket::header, &HakoCpp_BatchRequestPacket::header),
+        hako_pdu_field(&Hako_BatchRequestPacket::body, &HakoCpp_BatchRequestPacket::body)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_BatchRequestPacket(const char* heap_ptr, Hako_BatchRequestPacket &src, HakoCpp_BatchRequestPacket &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_BatchRequestPacket(Hako_BatchRequestPacket &src, HakoCpp_BatchRequestPacket &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_BatchRequestPacket(HakoCpp_BatchRequestPacket &src, Hako_BatchRequestPacket &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_BatchRequestPacket(HakoCpp_BatchRequestPacket &src, Hako_BatchRequestPacket** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_BatchRequestPacket* hako_create_empty_pdu_BatchRequestPacket(int heap_size)
+{
+    return (Hako_BatchRequestPacket*)hako_create_empty_pdu(sizeof(Hako_BatchRequestPacket), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class BatchRequestPacket : public HakoPduLayoutConvertor<Hako_BatchRequestPacket>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchRequestPacket_HPP_ */
@@ -0,0 +1,103 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchResponse_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchResponse.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_BatchResponse.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/BatchResponse.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_BatchResponse) == 96, "Hako_BatchResponse size does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, op_count) == 0 && sizeof(Hako_BatchResponse::op_count) == 4,
+              "Hako_BatchResponse::op_count does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, result_codes) == 4 && sizeof(Hako_BatchResponse::result_codes) == 32,
+              "Hako_BatchResponse::result_codes does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, values) == 36 && sizeof(Hako_BatchResponse::values) == 32,
+              "Hako_BatchResponse::values does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, master_time) == 72 && sizeof(Hako_BatchResponse::master_time) == 8,
+              "Hako_BatchResponse::master_time does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, is_pdu_created) == 80 && sizeof(Hako_BatchResponse::is_pdu_created) == 4,
+              "Hako_BatchResponse::is_pdu_created does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, is_simulation_mode) == 84 && sizeof(Hako_BatchResponse::is_simulation_mode) == 4,
+              "Hako_BatchResponse::is_simulation_mode does not match BatchResponse.offset");
+static_assert(offsetof(Hako_BatchResponse, is_pdu_sync_mode) == 88 && sizeof(Hako_BatchResponse::is_pdu_sync_mode) == 4,
+              "Hako_BatchResponse::is_pdu_sync_mode does not match BatchResponse.offset");
+
+template <>
+struct HakoPduLayout<Hako_BatchResponse> {
+    using cpp_type = HakoCpp_BatchResponse;
+    static constexpr const char* name = "BatchResponse";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_BatchResponse::op_count, &HakoCpp_BatchResponse::op_count),
+        hako_pdu_field(&Hako_BatchResponse::result_codes, &HakoCpp_BatchResponse::result_codes),
+        hako_pdu_field(&Hako_BatchResponse::values, &HakoCpp_BatchResponse::values),
+        hako_pdu_field(&Hako_BatchResponse::master_time, &HakoCpp_BatchResponse::master_time),
+        hako_pdu_field(&Hako_BatchResponse::is_pdu_created, &HakoCpp_BatchResponse::is_pdu_created),
+        hako_pdu_field(&Hako_BatchResponse::is_simulation_mode, &HakoCpp_BatchResponse::is_simulation_mode),
+        hako_pdu_field(&Hako_BatchResponse::is_pdu_sync_mode, &HakoCpp_BatchResponse::is_pdu_sync_mode)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_BatchResponse(const char* heap_ptr, Hako_BatchResponse &src, HakoCpp_BatchResponse &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_BatchResponse(Hako_BatchResponse &src, HakoCpp_BatchResponse &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_BatchResponse(HakoCpp_BatchResponse &src, Hako_BatchResponse &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_BatchResponse(HakoCpp_BatchResponse &src, Hako_BatchResponse** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_BatchResponse* hako_create_empty_pdu_BatchResponse(int heap_size)
+{
+    return (Hako_BatchResponse*)hako_create_empty_pdu(sizeof(Hako_BatchResponse), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class BatchResponse : public HakoPduLayoutConvertor<Hako_BatchResponse>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchResponse_HPP_ */
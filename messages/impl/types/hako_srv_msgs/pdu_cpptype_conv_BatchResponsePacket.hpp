@@ -0,0 +1,90 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchResponsePacket_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchResponsePacket.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_BatchResponsePacket.hpp"
+
+/*
+ * Dependent Convertors
+ */
+#include "hako_srv_msgs/pdu_cpptype_conv_BatchResponse.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_ServiceResponseHeader.hpp"
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/BatchResponsePacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_BatchResponsePacket) == 368, "Hako_BatchResponsePacket size does not match BatchResponsePacket.offset");
+static_assert(offsetof(Hako_BatchResponsePacket, header) == 0 && sizeof(Hako_BatchResponsePacket::header) == 268,
+              "Hako_BatchResponsePacket::header does not match BatchResponsePacket.offset");
+static_assert(offsetof(Hako_BatchResponsePacket, body) == 272 && sizeof(Hako_BatchResponsePacket::body) == 96,
+              "Hako_BatchResponsePacket::body does not match BatchResponsePacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_BatchResponsePacket> {
+    using cpp_type = HakoCpp_BatchResponsePacket;
+    static constexpr const char* name = "BatchResponsePacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_BatchResponsePacket::header, &HakoCpp_BatchResponsePacket::header),
+        hako_pdu_field(&Hako_BatchResponsePacket::body, &HakoCpp_BatchResponsePacket::body)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_BatchResponsePacket(const char* heap_ptr, Hako_BatchResponsePacket &src, HakoCpp_BatchResponsePacket &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_BatchResponsePacket(Hako_BatchResponsePacket &src, HakoCpp_BatchResponsePacket &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_BatchResponsePacket(HakoCpp_BatchResponsePacket &src, Hako_BatchResponsePacket &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_BatchResponsePacket(HakoCpp_BatchResponsePacket &src, Hako_BatchResponsePacket** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_BatchResponsePacket* hako_create_empty_pdu_BatchResponsePacket(int heap_size)
+{
+    return (Hako_BatchResponsePacket*)hako_create_empty_pdu(sizeof(Hako_BatchResponsePacket), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class BatchResponsePacket : public HakoPduLayoutConvertor<Hako_BatchResponsePacket>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_BatchResponsePacket_HPP_ */
@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -19,6 +20,28 @@
 #include "hako_srv_msgs/pdu_cpptype_conv_GetEventResponse.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_ServiceResponseHeader.hpp"
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetEventResponsePacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetEventResponsePacket) == 272, "Hako_GetEventResponsePacket size does not match GetEventResponsePacket.offset");
+static_assert(offsetof(Hako_GetEventResponsePacket, header) == 0 && sizeof(Hako_GetEventResponsePacket::header) == 268,
+              "Hako_GetEventResponsePacket::header does not match GetEventResponsePacket.offset");
+static_assert(offsetof(Hako_GetEventResponsePacket, body) == 268 && sizeof(Hako_GetEventResponsePacket::body) == 4,
+              "Hako_GetEventResponsePacket::body does not match GetEventResponsePacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetEventResponsePacket> {
+    using cpp_type = HakoCpp_GetEventResponsePacket;
+    static constexpr const char* name = "GetEventResponsePacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetEventResponsePacket::header, &HakoCpp_GetEventResponsePacket::header),
+        hako_pdu_field(&Hako_GetEventResponsePacket::body, &HakoCpp_GetEventResponsePacket::body)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -27,25 +50,12 @@
 
 static inline int cpp_pdu2cpp_GetEventResponsePacket(const char* heap_ptr, Hako_GetEventResponsePacket &src, HakoCpp_GetEventResponsePacket &dst)
 {
-    // Struct convert
-    cpp_pdu2cpp_ServiceResponseHeader(heap_ptr, src.header, dst.header);
-    // Struct convert
-    cpp_pdu2cpp_GetEventResponse(heap_ptr, src.body, dst.body);
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_GetEventResponsePacket(Hako_GetEventResponsePacket &src, HakoCpp_GetEventResponsePacket &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_GetEventResponsePacket((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -56,99 +66,25 @@ static inline int hako_convert_pdu2cpp_GetEventResponsePacket(Hako_GetEventRespo
 
 static inline bool cpp_cpp2pdu_GetEventResponsePacket(HakoCpp_GetEventResponsePacket &src, Hako_GetEventResponsePacket &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // struct convert
-        cpp_cpp2pdu_ServiceResponseHeader(src.header, dst.header, dynamic_memory);
-        // struct convert
-        cpp_cpp2pdu_GetEventResponse(src.body, dst.body, dynamic_memory);
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_GetEventResponsePacket(HakoCpp_GetEventResponsePacket &src, Hako_GetEventResponsePacket** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_GetEventResponsePacket out;
-    if (!cpp_cpp2pdu_GetEventResponsePacket(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_GetEventResponsePacket), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_GetEventResponsePacket));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_GetEventResponsePacket*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_GetEventResponsePacket* hako_create_empty_pdu_GetEventResponsePacket(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_GetEventResponsePacket), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_GetEventResponsePacket*)base_ptr;
+    return (Hako_GetEventResponsePacket*)hako_create_empty_pdu(sizeof(Hako_GetEventResponsePacket), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class GetEventResponsePacket
+class GetEventResponsePacket : public HakoPduLayoutConvertor<Hako_GetEventResponsePacket>
 {
-public:
-    GetEventResponsePacket() = default;
-    ~GetEventResponsePacket() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_GetEventResponsePacket& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "GetEventResponsePacket" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_GetEventResponsePacket(*(Hako_GetEventResponsePacket*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "GetEventResponsePacket" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_GetEventResponsePacket& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_GetEventResponsePacket(cppData, (Hako_GetEventResponsePacket**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "GetEventResponsePacket" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "GetEventResponsePacket" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "GetEventResponsePacket" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetEventResponsePacket_HPP_ */
@@ -0,0 +1,88 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsRequest_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsRequest.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_GetServerStatsRequest.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetServerStatsRequest.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetServerStatsRequest) == 256, "Hako_GetServerStatsRequest size does not match GetServerStatsRequest.offset");
+static_assert(offsetof(Hako_GetServerStatsRequest, name) == 0 && sizeof(Hako_GetServerStatsRequest::name) == 128,
+              "Hako_GetServerStatsRequest::name does not match GetServerStatsRequest.offset");
+static_assert(offsetof(Hako_GetServerStatsRequest, service_name) == 128 && sizeof(Hako_GetServerStatsRequest::service_name) == 128,
+              "Hako_GetServerStatsRequest::service_name does not match GetServerStatsRequest.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetServerStatsRequest> {
+    using cpp_type = HakoCpp_GetServerStatsRequest;
+    static constexpr const char* name = "GetServerStatsRequest";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetServerStatsRequest::name, &HakoCpp_GetServerStatsRequest::name),
+        hako_pdu_field(&Hako_GetServerStatsRequest::service_name, &HakoCpp_GetServerStatsRequest::service_name)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_GetServerStatsRequest(const char* heap_ptr, Hako_GetServerStatsRequest &src, HakoCpp_GetServerStatsRequest &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_GetServerStatsRequest(Hako_GetServerStatsRequest &src, HakoCpp_GetServerStatsRequest &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_GetServerStatsRequest(HakoCpp_GetServerStatsRequest &src, Hako_GetServerStatsRequest &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_GetServerStatsRequest(HakoCpp_GetServerStatsRequest &src, Hako_GetServerStatsRequest** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_GetServerStatsRequest* hako_create_empty_pdu_GetServerStatsRequest(int heap_size)
+{
+    return (Hako_GetServerStatsRequest*)hako_create_empty_pdu(sizeof(Hako_GetServerStatsRequest), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class GetServerStatsRequest : public HakoPduLayoutConvertor<Hako_GetServerStatsRequest>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsRequest_HPP_ */
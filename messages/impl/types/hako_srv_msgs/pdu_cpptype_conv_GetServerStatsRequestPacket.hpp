@@ -0,0 +1,90 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsRequestPacket_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsRequestPacket.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_GetServerStatsRequestPacket.hpp"
+
+/*
+ * Dependent Convertors
+ */
+#include "hako_srv_msgs/pdu_cpptype_conv_GetServerStatsRequest.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_ServiceRequestHeader.hpp"
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetServerStatsRequestPacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetServerStatsRequestPacket) == 524, "Hako_GetServerStatsRequestPacket size does not match GetServerStatsRequestPacket.offset");
+static_assert(offsetof(Hako_GetServerStatsRequestPacket, header) == 0 && sizeof(Hako_GetServerStatsRequestPacket::header) == 268,
+              "Hako_GetServerStatsRequestPacket::header does not match GetServerStatsRequestPacket.offset");
+static_assert(offsetof(Hako_GetServerStatsRequestPacket, body) == 268 && sizeof(Hako_GetServerStatsRequestPacket::body) == 256,
+              "Hako_GetServerStatsRequestPacket::body does not match GetServerStatsRequestPacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetServerStatsRequestPacket> {
+    using cpp_type = HakoCpp_GetServerStatsRequestPacket;
+    static constexpr const char* name = "GetServerStatsRequestPacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetServerStatsRequestPacket::header, &HakoCpp_GetServerStatsRequestPacket::header),
+        hako_pdu_field(&Hako_GetServerStatsRequestPacket::body, &HakoCpp_GetServerStatsRequestPacket::body)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_GetServerStatsRequestPacket(const char* heap_ptr, Hako_GetServerStatsRequestPacket &src, HakoCpp_GetServerStatsRequestPacket &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_GetServerStatsRequestPacket(Hako_GetServerStatsRequestPacket &src, HakoCpp_GetServerStatsRequestPacket &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_GetServerStatsRequestPacket(HakoCpp_GetServerStatsRequestPacket &src, Hako_GetServerStatsRequestPacket &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_GetServerStatsRequestPacket(HakoCpp_GetServerStatsRequestPacket &src, Hako_GetServerStatsRequestPacket** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_GetServerStatsRequestPacket* hako_create_empty_pdu_GetServerStatsRequestPacket(int heap_size)
+{
+    return (Hako_GetServerStatsRequestPacket*)hako_create_empty_pdu(sizeof(Hako_GetServerStatsRequestPacket), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class GetServerStatsRequestPacket : public HakoPduLayoutConvertor<Hako_GetServerStatsRequestPacket>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsRequestPacket_HPP_ */
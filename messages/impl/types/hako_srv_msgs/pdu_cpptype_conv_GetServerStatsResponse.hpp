@@ -0,0 +1,139 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsResponse.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_GetServerStatsResponse.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetServerStatsResponse.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetServerStatsResponse) == 272, "Hako_GetServerStatsResponse size does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, service_name) == 0 && sizeof(Hako_GetServerStatsResponse::service_name) == 128,
+              "Hako_GetServerStatsResponse::service_name does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, count) == 128 && sizeof(Hako_GetServerStatsResponse::count) == 8,
+              "Hako_GetServerStatsResponse::count does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, rejected) == 136 && sizeof(Hako_GetServerStatsResponse::rejected) == 8,
+              "Hako_GetServerStatsResponse::rejected does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, queue_wait_p50_usec) == 144 && sizeof(Hako_GetServerStatsResponse::queue_wait_p50_usec) == 8,
+              "Hako_GetServerStatsResponse::queue_wait_p50_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, queue_wait_p99_usec) == 152 && sizeof(Hako_GetServerStatsResponse::queue_wait_p99_usec) == 8,
+              "Hako_GetServerStatsResponse::queue_wait_p99_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, queue_wait_p999_usec) == 160 && sizeof(Hako_GetServerStatsResponse::queue_wait_p999_usec) == 8,
+              "Hako_GetServerStatsResponse::queue_wait_p999_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, queue_wait_max_usec) == 168 && sizeof(Hako_GetServerStatsResponse::queue_wait_max_usec) == 8,
+              "Hako_GetServerStatsResponse::queue_wait_max_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, handler_p50_usec) == 176 && sizeof(Hako_GetServerStatsResponse::handler_p50_usec) == 8,
+              "Hako_GetServerStatsResponse::handler_p50_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, handler_p99_usec) == 184 && sizeof(Hako_GetServerStatsResponse::handler_p99_usec) == 8,
+              "Hako_GetServerStatsResponse::handler_p99_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, handler_p999_usec) == 192 && sizeof(Hako_GetServerStatsResponse::handler_p999_usec) == 8,
+              "Hako_GetServerStatsResponse::handler_p999_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, handler_max_usec) == 200 && sizeof(Hako_GetServerStatsResponse::handler_max_usec) == 8,
+              "Hako_GetServerStatsResponse::handler_max_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, reply_p50_usec) == 208 && sizeof(Hako_GetServerStatsResponse::reply_p50_usec) == 8,
+              "Hako_GetServerStatsResponse::reply_p50_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, reply_p99_usec) == 216 && sizeof(Hako_GetServerStatsResponse::reply_p99_usec) == 8,
+              "Hako_GetServerStatsResponse::reply_p99_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, reply_p999_usec) == 224 && sizeof(Hako_GetServerStatsResponse::reply_p999_usec) == 8,
+              "Hako_GetServerStatsResponse::reply_p999_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, reply_max_usec) == 232 && sizeof(Hako_GetServerStatsResponse::reply_max_usec) == 8,
+              "Hako_GetServerStatsResponse::reply_max_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, total_p50_usec) == 240 && sizeof(Hako_GetServerStatsResponse::total_p50_usec) == 8,
+              "Hako_GetServerStatsResponse::total_p50_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, total_p99_usec) == 248 && sizeof(Hako_GetServerStatsResponse::total_p99_usec) == 8,
+              "Hako_GetServerStatsResponse::total_p99_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, total_p999_usec) == 256 && sizeof(Hako_GetServerStatsResponse::total_p999_usec) == 8,
+              "Hako_GetServerStatsResponse::total_p999_usec does not match GetServerStatsResponse.offset");
+static_assert(offsetof(Hako_GetServerStatsResponse, total_max_usec) == 264 && sizeof(Hako_GetServerStatsResponse::total_max_usec) == 8,
+              "Hako_GetServerStatsResponse::total_max_usec does not match GetServerStatsResponse.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetServerStatsResponse> {
+    using cpp_type = HakoCpp_GetServerStatsResponse;
+    static constexpr const char* name = "GetServerStatsResponse";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetServerStatsResponse::service_name, &HakoCpp_GetServerStatsResponse::service_name),
+        hako_pdu_field(&Hako_GetServerStatsResponse::count, &HakoCpp_GetServerStatsResponse::count),
+        hako_pdu_field(&Hako_GetServerStatsResponse::rejected, &HakoCpp_GetServerStatsResponse::rejected),
+        hako_pdu_field(&Hako_GetServerStatsResponse::queue_wait_p50_usec, &HakoCpp_GetServerStatsResponse::queue_wait_p50_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::queue_wait_p99_usec, &HakoCpp_GetServerStatsResponse::queue_wait_p99_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::queue_wait_p999_usec, &HakoCpp_GetServerStatsResponse::queue_wait_p999_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::queue_wait_max_usec, &HakoCpp_GetServerStatsResponse::queue_wait_max_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::handler_p50_usec, &HakoCpp_GetServerStatsResponse::handler_p50_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::handler_p99_usec, &HakoCpp_GetServerStatsResponse::handler_p99_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::handler_p999_usec, &HakoCpp_GetServerStatsResponse::handler_p999_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::handler_max_usec, &HakoCpp_GetServerStatsResponse::handler_max_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::reply_p50_usec, &HakoCpp_GetServerStatsResponse::reply_p50_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::reply_p99_usec, &HakoCpp_GetServerStatsResponse::reply_p99_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::reply_p999_usec, &HakoCpp_GetServerStatsResponse::reply_p999_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::reply_max_usec, &HakoCpp_GetServerStatsResponse::reply_max_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::total_p50_usec, &HakoCpp_GetServerStatsResponse::total_p50_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::total_p99_usec, &HakoCpp_GetServerStatsResponse::total_p99_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::total_p999_usec, &HakoCpp_GetServerStatsResponse::total_p999_usec),
+        hako_pdu_field(&Hako_GetServerStatsResponse::total_max_usec, &HakoCpp_GetServerStatsResponse::total_max_usec)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_GetServerStatsResponse(const char* heap_ptr, Hako_GetServerStatsResponse &src, HakoCpp_GetServerStatsResponse &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_GetServerStatsResponse(Hako_GetServerStatsResponse &src, HakoCpp_GetServerStatsResponse &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_GetServerStatsResponse(HakoCpp_GetServerStatsResponse &src, Hako_GetServerStatsResponse &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_GetServerStatsResponse(HakoCpp_GetServerStatsResponse &src, Hako_GetServerStatsResponse** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_GetServerStatsResponse* hako_create_empty_pdu_GetServerStatsResponse(int heap_size)
+{
+    return (Hako_GetServerStatsResponse*)hako_create_empty_pdu(sizeof(Hako_GetServerStatsResponse), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class GetServerStatsResponse : public HakoPduLayoutConvertor<Hako_GetServerStatsResponse>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_ */
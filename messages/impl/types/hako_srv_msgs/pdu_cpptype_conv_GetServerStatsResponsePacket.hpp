@@ -0,0 +1,90 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponsePacket_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsResponsePacket.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_GetServerStatsResponsePacket.hpp"
+
+/*
+ * Dependent Convertors
+ */
+#include "hako_srv_msgs/pdu_cpptype_conv_GetServerStatsResponse.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_ServiceResponseHeader.hpp"
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetServerStatsResponsePacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetServerStatsResponsePacket) == 544, "Hako_GetServerStatsResponsePacket size does not match GetServerStatsResponsePacket.offset");
+static_assert(offsetof(Hako_GetServerStatsResponsePacket, header) == 0 && sizeof(Hako_GetServerStatsResponsePacket::header) == 268,
+              "Hako_GetServerStatsResponsePacket::header does not match GetServerStatsResponsePacket.offset");
+static_assert(offsetof(Hako_GetServerStatsResponsePacket, body) == 272 && sizeof(Hako_GetServerStatsResponsePacket::body) == 272,
+              "Hako_GetServerStatsResponsePacket::body does not match GetServerStatsResponsePacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetServerStatsResponsePacket> {
+    using cpp_type = HakoCpp_GetServerStatsResponsePacket;
+    static constexpr const char* name = "GetServerStatsResponsePacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetServerStatsResponsePacket::header, &HakoCpp_GetServerStatsResponsePacket::header),
+        hako_pdu_field(&Hako_GetServerStatsResponsePacket::body, &HakoCpp_GetServerStatsResponsePacket::body)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_GetServerStatsResponsePacket(const char* heap_ptr, Hako_GetServerStatsResponsePacket &src, HakoCpp_GetServerStatsResponsePacket &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_GetServerStatsResponsePacket(Hako_GetServerStatsResponsePacket &src, HakoCpp_GetServerStatsResponsePacket &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_GetServerStatsResponsePacket(HakoCpp_GetServerStatsResponsePacket &src, Hako_GetServerStatsResponsePacket &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_GetServerStatsResponsePacket(HakoCpp_GetServerStatsResponsePacket &src, Hako_GetServerStatsResponsePacket** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_GetServerStatsResponsePacket* hako_create_empty_pdu_GetServerStatsResponsePacket(int heap_size)
+{
+    return (Hako_GetServerStatsResponsePacket*)hako_create_empty_pdu(sizeof(Hako_GetServerStatsResponsePacket), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class GetServerStatsResponsePacket : public HakoPduLayoutConvertor<Hako_GetServerStatsResponsePacket>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponsePacket_HPP_ */
@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,25 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetSimStateRequest.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetSimStateRequest) == 128, "Hako_GetSimStateRequest size does not match GetSimStateRequest.offset");
+static_assert(offsetof(Hako_GetSimStateRequest, name) == 0 && sizeof(Hako_GetSimStateRequest::name) == 128,
+              "Hako_GetSimStateRequest::name does not match GetSimStateRequest.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetSimStateRequest> {
+    using cpp_type = HakoCpp_GetSimStateRequest;
+    static constexpr const char* name = "GetSimStateRequest";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetSimStateRequest::name, &HakoCpp_GetSimStateRequest::name)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,23 +45,12 @@
 
 static inline int cpp_pdu2cpp_GetSimStateRequest(const char* heap_ptr, Hako_GetSimStateRequest &src, HakoCpp_GetSimStateRequest &dst)
 {
-    // string convertor
-    dst.name = (const char*)src.name;
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_GetSimStateRequest(Hako_GetSimStateRequest &src, HakoCpp_GetSimStateRequest &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_GetSimStateRequest((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -52,100 +61,25 @@ static inline int hako_convert_pdu2cpp_GetSimStateRequest(Hako_GetSimStateReques
 
 static inline bool cpp_cpp2pdu_GetSimStateRequest(HakoCpp_GetSimStateRequest &src, Hako_GetSimStateRequest &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // string convertor
-        (void)hako_convert_cpp2pdu_array(
-            src.name, src.name.length(),
-            dst.name, M_ARRAY_SIZE(Hako_GetSimStateRequest, char, name));
-        dst.name[src.name.length()] = '\0';
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_GetSimStateRequest(HakoCpp_GetSimStateRequest &src, Hako_GetSimStateRequest** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_GetSimStateRequest out;
-    if (!cpp_cpp2pdu_GetSimStateRequest(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_GetSimStateRequest), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_GetSimStateRequest));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_GetSimStateRequest*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_GetSimStateRequest* hako_create_empty_pdu_GetSimStateRequest(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_GetSimStateRequest), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_GetSimStateRequest*)base_ptr;
+    return (Hako_GetSimStateRequest*)hako_create_empty_pdu(sizeof(Hako_GetSimStateRequest), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class GetSimStateRequest
+class GetSimStateRequest : public HakoPduLayoutConvertor<Hako_GetSimStateRequest>
 {
-public:
-    GetSimStateRequest() = default;
-    ~GetSimStateRequest() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_GetSimStateRequest& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "GetSimStateRequest" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_GetSimStateRequest(*(Hako_GetSimStateRequest*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "GetSimStateRequest" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_GetSimStateRequest& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_GetSimStateRequest(cppData, (Hako_GetSimStateRequest**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "GetSimStateRequest" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "GetSimStateRequest" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "GetSimStateRequest" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetSimStateRequest_HPP_ */
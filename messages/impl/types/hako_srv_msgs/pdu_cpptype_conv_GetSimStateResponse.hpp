@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,37 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/GetSimStateResponse.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_GetSimStateResponse) == 32, "Hako_GetSimStateResponse size does not match GetSimStateResponse.offset");
+static_assert(offsetof(Hako_GetSimStateResponse, sim_state) == 0 && sizeof(Hako_GetSimStateResponse::sim_state) == 4,
+              "Hako_GetSimStateResponse::sim_state does not match GetSimStateResponse.offset");
+static_assert(offsetof(Hako_GetSimStateResponse, master_time) == 8 && sizeof(Hako_GetSimStateResponse::master_time) == 8,
+              "Hako_GetSimStateResponse::master_time does not match GetSimStateResponse.offset");
+static_assert(offsetof(Hako_GetSimStateResponse, is_pdu_created) == 16 && sizeof(Hako_GetSimStateResponse::is_pdu_created) == 4,
+              "Hako_GetSimStateResponse::is_pdu_created does not match GetSimStateResponse.offset");
+static_assert(offsetof(Hako_GetSimStateResponse, is_simulation_mode) == 20 && sizeof(Hako_GetSimStateResponse::is_simulation_mode) == 4,
+              "Hako_GetSimStateResponse::is_simulation_mode does not match GetSimStateResponse.offset");
+static_assert(offsetof(Hako_GetSimStateResponse, is_pdu_sync_mode) == 24 && sizeof(Hako_GetSimStateResponse::is_pdu_sync_mode) == 4,
+              "Hako_GetSimStateResponse::is_pdu_sync_mode does not match GetSimStateResponse.offset");
+
+template <>
+struct HakoPduLayout<Hako_GetSimStateResponse> {
+    using cpp_type = HakoCpp_GetSimStateResponse;
+    static constexpr const char* name = "GetSimStateResponse";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_GetSimStateResponse::sim_state, &HakoCpp_GetSimStateResponse::sim_state),
+        hako_pdu_field(&Hako_GetSimStateResponse::master_time, &HakoCpp_GetSimStateResponse::master_time),
+        hako_pdu_field(&Hako_GetSimStateResponse::is_pdu_created, &HakoCpp_GetSimStateResponse::is_pdu_created),
+        hako_pdu_field(&Hako_GetSimStateResponse::is_simulation_mode, &HakoCpp_GetSimStateResponse::is_simulation_mode),
+        hako_pdu_field(&Hako_GetSimStateResponse::is_pdu_sync_mode, &HakoCpp_GetSimStateResponse::is_pdu_sync_mode)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,31 +57,12 @@
 
 static inline int cpp_pdu2cpp_GetSimStateResponse(const char* heap_ptr, Hako_GetSimStateResponse &src, HakoCpp_GetSimStateResponse &dst)
 {
-    // primitive convert
-    hako_convert_pdu2cpp(src.sim_state, dst.sim_state);
-    // primitive convert
-    hako_convert_pdu2cpp(src.master_time, dst.master_time);
-    // primitive convert
-    hako_convert_pdu2cpp(src.is_pdu_created, dst.is_pdu_created);
-    // primitive convert
-    hako_convert_pdu2cpp(src.is_simulation_mode, dst.is_simulation_mode);
-    // primitive convert
-    hako_convert_pdu2cpp(src.is_pdu_sync_mode, dst.is_pdu_sync_mode);
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_GetSimStateResponse(Hako_GetSimStateResponse &src, HakoCpp_GetSimStateResponse &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_GetSimStateResponse((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -60,105 +73,25 @@ static inline int hako_convert_pdu2cpp_GetSimStateResponse(Hako_GetSimStateRespo
 
 static inline bool cpp_cpp2pdu_GetSimStateResponse(HakoCpp_GetSimStateResponse &src, Hako_GetSimStateResponse &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // primitive convert
-        hako_convert_cpp2pdu(src.sim_state, dst.sim_state);
-        // primitive convert
-        hako_convert_cpp2pdu(src.master_time, dst.master_time);
-        // primitive convert
-        hako_convert_cpp2pdu(src.is_pdu_created, dst.is_pdu_created);
-        // primitive convert
-        hako_convert_cpp2pdu(src.is_simulation_mode, dst.is_simulation_mode);
-        // primitive convert
-        hako_convert_cpp2pdu(src.is_pdu_sync_mode, dst.is_pdu_sync_mode);
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_GetSimStateResponse(HakoCpp_GetSimStateResponse &src, Hako_GetSimStateResponse** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_GetSimStateResponse out;
-    if (!cpp_cpp2pdu_GetSimStateResponse(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_GetSimStateResponse), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_GetSimStateResponse));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_GetSimStateResponse*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_GetSimStateResponse* hako_create_empty_pdu_GetSimStateResponse(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_GetSimStateResponse), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_GetSimStateResponse*)base_ptr;
+    return (Hako_GetSimStateResponse*)hako_create_empty_pdu(sizeof(Hako_GetSimStateResponse), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class GetSimStateResponse
+class GetSimStateResponse : public HakoPduLayoutConvertor<Hako_GetSimStateResponse>
 {
-public:
-    GetSimStateResponse() = default;
-    ~GetSimStateResponse() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_GetSimStateResponse& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "GetSimStateResponse" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_GetSimStateResponse(*(Hako_GetSimStateResponse*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "GetSimStateResponse" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_GetSimStateResponse& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_GetSimStateResponse(cppData, (Hako_GetSimStateResponse**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "GetSimStateResponse" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "GetSimStateResponse" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "GetSimStateResponse" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_GetSimStateResponse_HPP_ */
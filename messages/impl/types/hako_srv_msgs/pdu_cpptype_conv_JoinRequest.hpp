@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,28 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/JoinRequest.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_JoinRequest) == 136, "Hako_JoinRequest size does not match JoinRequest.offset");
+static_assert(offsetof(Hako_JoinRequest, name) == 0 && sizeof(Hako_JoinRequest::name) == 128,
+              "Hako_JoinRequest::name does not match JoinRequest.offset");
+static_assert(offsetof(Hako_JoinRequest, session_token) == 128 && sizeof(Hako_JoinRequest::session_token) == 8,
+              "Hako_JoinRequest::session_token does not match JoinRequest.offset");
+
+template <>
+struct HakoPduLayout<Hako_JoinRequest> {
+    using cpp_type = HakoCpp_JoinRequest;
+    static constexpr const char* name = "JoinRequest";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_JoinRequest::name, &HakoCpp_JoinRequest::name),
+        hako_pdu_field(&Hako_JoinRequest::session_token, &HakoCpp_JoinRequest::session_token)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,23 +48,12 @@
 
 static inline int cpp_pdu2cpp_JoinRequest(const char* heap_ptr, Hako_JoinRequest &src, HakoCpp_JoinRequest &dst)
 {
-    // string convertor
-    dst.name = (const char*)src.name;
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_JoinRequest(Hako_JoinRequest &src, HakoCpp_JoinRequest &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_JoinRequest((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -52,100 +64,25 @@ static inline int hako_convert_pdu2cpp_JoinRequest(Hako_JoinRequest &src, HakoCp
 
 static inline bool cpp_cpp2pdu_JoinRequest(HakoCpp_JoinRequest &src, Hako_JoinRequest &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // string convertor
-        (void)hako_convert_cpp2pdu_array(
-            src.name, src.name.length(),
-            dst.name, M_ARRAY_SIZE(Hako_JoinRequest, char, name));
-        dst.name[src.name.length()] = '\0';
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_JoinRequest(HakoCpp_JoinRequest &src, Hako_JoinRequest** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_JoinRequest out;
-    if (!cpp_cpp2pdu_JoinRequest(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_JoinRequest), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_JoinRequest));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_JoinRequest*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_JoinRequest* hako_create_empty_pdu_JoinRequest(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_JoinRequest), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_JoinRequest*)base_ptr;
+    return (Hako_JoinRequest*)hako_create_empty_pdu(sizeof(Hako_JoinRequest), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class JoinRequest
+class JoinRequest : public HakoPduLayoutConvertor<Hako_JoinRequest>
 {
-public:
-    JoinRequest() = default;
-    ~JoinRequest() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_JoinRequest& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "JoinRequest" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_JoinRequest(*(Hako_JoinRequest*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "JoinRequest" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_JoinRequest& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_JoinRequest(cppData, (Hako_JoinRequest**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "JoinRequest" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "JoinRequest" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "JoinRequest" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_JoinRequest_HPP_ */
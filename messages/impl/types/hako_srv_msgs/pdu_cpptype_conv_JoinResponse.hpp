@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,31 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/JoinResponse.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_JoinResponse) == 144, "Hako_JoinResponse size does not match JoinResponse.offset");
+static_assert(offsetof(Hako_JoinResponse, status_code) == 0 && sizeof(Hako_JoinResponse::status_code) == 4,
+              "Hako_JoinResponse::status_code does not match JoinResponse.offset");
+static_assert(offsetof(Hako_JoinResponse, message) == 4 && sizeof(Hako_JoinResponse::message) == 128,
+              "Hako_JoinResponse::message does not match JoinResponse.offset");
+static_assert(offsetof(Hako_JoinResponse, session_token) == 136 && sizeof(Hako_JoinResponse::session_token) == 8,
+              "Hako_JoinResponse::session_token does not match JoinResponse.offset");
+
+template <>
+struct HakoPduLayout<Hako_JoinResponse> {
+    using cpp_type = HakoCpp_JoinResponse;
+    static constexpr const char* name = "JoinResponse";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_JoinResponse::status_code, &HakoCpp_JoinResponse::status_code),
+        hako_pdu_field(&Hako_JoinResponse::message, &HakoCpp_JoinResponse::message),
+        hako_pdu_field(&Hako_JoinResponse::session_token, &HakoCpp_JoinResponse::session_token)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,25 +51,12 @@
 
 static inline int cpp_pdu2cpp_JoinResponse(const char* heap_ptr, Hako_JoinResponse &src, HakoCpp_JoinResponse &dst)
 {
-    // primitive convert
-    hako_convert_pdu2cpp(src.status_code, dst.status_code);
-    // string convertor
-    dst.message = (const char*)src.message;
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_JoinResponse(Hako_JoinResponse &src, HakoCpp_JoinResponse &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_JoinResponse((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -54,102 +67,25 @@ static inline int hako_convert_pdu2cpp_JoinResponse(Hako_JoinResponse &src, Hako
 
 static inline bool cpp_cpp2pdu_JoinResponse(HakoCpp_JoinResponse &src, Hako_JoinResponse &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // primitive convert
-        hako_convert_cpp2pdu(src.status_code, dst.status_code);
-        // string convertor
-        (void)hako_convert_cpp2pdu_array(
-            src.message, src.message.length(),
-            dst.message, M_ARRAY_SIZE(Hako_JoinResponse, char, message));
-        dst.message[src.message.length()] = '\0';
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_JoinResponse(HakoCpp_JoinResponse &src, Hako_JoinResponse** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_JoinResponse out;
-    if (!cpp_cpp2pdu_JoinResponse(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_JoinResponse), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_JoinResponse));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_JoinResponse*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_JoinResponse* hako_create_empty_pdu_JoinResponse(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_JoinResponse), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_JoinResponse*)base_ptr;
+    return (Hako_JoinResponse*)hako_create_empty_pdu(sizeof(Hako_JoinResponse), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class JoinResponse
+class JoinResponse : public HakoPduLayoutConvertor<Hako_JoinResponse>
 {
-public:
-    JoinResponse() = default;
-    ~JoinResponse() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_JoinResponse& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "JoinResponse" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_JoinResponse(*(Hako_JoinResponse*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "JoinResponse" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_JoinResponse& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_JoinResponse(cppData, (Hako_JoinResponse**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "JoinResponse" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "JoinResponse" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "JoinResponse" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_JoinResponse_HPP_ */
@@ -4,6 +4,7 @@
 #include "pdu_primitive_ctypes.h"
 #include "pdu_primitive_ctypes_conv.hpp"
 #include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
 /*
  * Dependent pdu data
  */
@@ -17,6 +18,37 @@
  * Dependent Convertors
  */
 
+/***************************
+ *
+ * Layout (hako_srv_msgs/ServiceRequestHeader.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_ServiceRequestHeader) == 268, "Hako_ServiceRequestHeader size does not match ServiceRequestHeader.offset");
+static_assert(offsetof(Hako_ServiceRequestHeader, request_id) == 0 && sizeof(Hako_ServiceRequestHeader::request_id) == 4,
+              "Hako_ServiceRequestHeader::request_id does not match ServiceRequestHeader.offset");
+static_assert(offsetof(Hako_ServiceRequestHeader, service_name) == 4 && sizeof(Hako_ServiceRequestHeader::service_name) == 128,
+              "Hako_ServiceRequestHeader::service_name does not match ServiceRequestHeader.offset");
+static_assert(offsetof(Hako_ServiceRequestHeader, client_name) == 132 && sizeof(Hako_ServiceRequestHeader::client_name) == 128,
+              "Hako_ServiceRequestHeader::client_name does not match ServiceRequestHeader.offset");
+static_assert(offsetof(Hako_ServiceRequestHeader, opcode) == 260 && sizeof(Hako_ServiceRequestHeader::opcode) == 1,
+              "Hako_ServiceRequestHeader::opcode does not match ServiceRequestHeader.offset");
+static_assert(offsetof(Hako_ServiceRequestHeader, status_poll_interval_msec) == 264 && sizeof(Hako_ServiceRequestHeader::status_poll_interval_msec) == 4,
+              "Hako_ServiceRequestHeader::status_poll_interval_msec does not match ServiceRequestHeader.offset");
+
+template <>
+struct HakoPduLayout<Hako_ServiceRequestHeader> {
+    using cpp_type = HakoCpp_ServiceRequestHeader;
+    static constexpr const char* name = "ServiceRequestHeader";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_ServiceRequestHeader::request_id, &HakoCpp_ServiceRequestHeader::request_id),
+        hako_pdu_field(&Hako_ServiceRequestHeader::service_name, &HakoCpp_ServiceRequestHeader::service_name),
+        hako_pdu_field(&Hako_ServiceRequestHeader::client_name, &HakoCpp_ServiceRequestHeader::client_name),
+        hako_pdu_field(&Hako_ServiceRequestHeader::opcode, &HakoCpp_ServiceRequestHeader::opcode),
+        hako_pdu_field(&Hako_ServiceRequestHeader::status_poll_interval_msec, &HakoCpp_ServiceRequestHeader::status_poll_interval_msec)
+    );
+};
+
 /***************************
  *
  * PDU ==> CPP PDU
@@ -25,31 +57,12 @@
 
 static inline int cpp_pdu2cpp_ServiceRequestHeader(const char* heap_ptr, Hako_ServiceRequestHeader &src, HakoCpp_ServiceRequestHeader &dst)
 {
-    // primitive convert
-    hako_convert_pdu2cpp(src.request_id, dst.request_id);
-    // string convertor
-    dst.service_name = (const char*)src.service_name;
-    // string convertor
-    dst.client_name = (const char*)src.client_name;
-    // primitive convert
-    hako_convert_pdu2cpp(src.opcode, dst.opcode);
-    // primitive convert
-    hako_convert_pdu2cpp(src.status_poll_interval_msec, dst.status_poll_interval_msec);
-    (void)heap_ptr;
-    return 0;
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
 }
 
 static inline int hako_convert_pdu2cpp_ServiceRequestHeader(Hako_ServiceRequestHeader &src, HakoCpp_ServiceRequestHeader &dst)
 {
-    void* base_ptr = (void*)&src;
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    // Validate magic number and version
-    if (heap_ptr == nullptr) {
-        return -1; // Invalid PDU metadata
-    }
-    else {
-        return cpp_pdu2cpp_ServiceRequestHeader((char*)heap_ptr, src, dst);
-    }
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
 }
 
 /***************************
@@ -60,111 +73,25 @@ static inline int hako_convert_pdu2cpp_ServiceRequestHeader(Hako_ServiceRequestH
 
 static inline bool cpp_cpp2pdu_ServiceRequestHeader(HakoCpp_ServiceRequestHeader &src, Hako_ServiceRequestHeader &dst, PduDynamicMemory &dynamic_memory)
 {
-    try {
-        // primitive convert
-        hako_convert_cpp2pdu(src.request_id, dst.request_id);
-        // string convertor
-        (void)hako_convert_cpp2pdu_array(
-            src.service_name, src.service_name.length(),
-            dst.service_name, M_ARRAY_SIZE(Hako_ServiceRequestHeader, char, service_name));
-        dst.service_name[src.service_name.length()] = '\0';
-        // string convertor
-        (void)hako_convert_cpp2pdu_array(
-            src.client_name, src.client_name.length(),
-            dst.client_name, M_ARRAY_SIZE(Hako_ServiceRequestHeader, char, client_name));
-        dst.client_name[src.client_name.length()] = '\0';
-        // primitive convert
-        hako_convert_cpp2pdu(src.opcode, dst.opcode);
-        // primitive convert
-        hako_convert_cpp2pdu(src.status_poll_interval_msec, dst.status_poll_interval_msec);
-    } catch (const std::runtime_error& e) {
-        std::cerr << "convertor error: " << e.what() << std::endl;
-        return false;
-    }
-    (void)dynamic_memory;
-    return true;
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
 }
 
 static inline int hako_convert_cpp2pdu_ServiceRequestHeader(HakoCpp_ServiceRequestHeader &src, Hako_ServiceRequestHeader** dst)
 {
-    PduDynamicMemory dynamic_memory;
-    Hako_ServiceRequestHeader out;
-    if (!cpp_cpp2pdu_ServiceRequestHeader(src, out, dynamic_memory)) {
-        return -1;
-    }
-    int heap_size = dynamic_memory.get_total_size();
-    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_ServiceRequestHeader), heap_size);
-    if (base_ptr == nullptr) {
-        return -1;
-    }
-    // Copy out on base data
-    memcpy(base_ptr, (void*)&out, sizeof(Hako_ServiceRequestHeader));
-
-    // Copy dynamic part and set offsets
-    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
-    dynamic_memory.copy_to_pdu((char*)heap_ptr);
-
-    *dst = (Hako_ServiceRequestHeader*)base_ptr;
-    return hako_get_pdu_meta_data(base_ptr)->total_size;
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
 }
 
 static inline Hako_ServiceRequestHeader* hako_create_empty_pdu_ServiceRequestHeader(int heap_size)
 {
-    // Allocate PDU memory
-    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_ServiceRequestHeader), heap_size);
-    if (base_ptr == nullptr) {
-        return nullptr;
-    }
-    return (Hako_ServiceRequestHeader*)base_ptr;
+    return (Hako_ServiceRequestHeader*)hako_create_empty_pdu(sizeof(Hako_ServiceRequestHeader), heap_size);
 }
+
 namespace hako::pdu::msgs::hako_srv_msgs
 {
-class ServiceRequestHeader
+class ServiceRequestHeader : public HakoPduLayoutConvertor<Hako_ServiceRequestHeader>
 {
-public:
-    ServiceRequestHeader() = default;
-    ~ServiceRequestHeader() = default;
-
-    bool pdu2cpp(char* top_ptr, HakoCpp_ServiceRequestHeader& cppData)
-    {
-        char* base_ptr = (char*)hako_get_base_ptr_pdu((void*)top_ptr);
-        if (base_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "ServiceRequestHeader" << "] hako_get_base_ptr_pdu returned null" << std::endl;
-            return false;
-        } 
-        int ret = hako_convert_pdu2cpp_ServiceRequestHeader(*(Hako_ServiceRequestHeader*)base_ptr, cppData);
-        if (ret != 0) {
-            std::cerr << "[ConvertorError][" << "ServiceRequestHeader" << "] hako_convert_pdu2cpp returned " << ret << std::endl;
-            return false;
-        }
-        return true;
-    }
-
-    int cpp2pdu(HakoCpp_ServiceRequestHeader& cppData, char* pdu_buffer, int buffer_len)
-    {
-        char* base_ptr = nullptr;
-        int pdu_size = hako_convert_cpp2pdu_ServiceRequestHeader(cppData, (Hako_ServiceRequestHeader**)&base_ptr);
-        if (pdu_size < 0) {
-            std::cerr << "[ConvertorError][" << "ServiceRequestHeader" << "] hako_convert_cpp2pdu returned error code: " << pdu_size << std::endl;
-            return -1;
-        }
-        if (pdu_size > buffer_len) {
-            std::cerr << "[ConvertorError][" << "ServiceRequestHeader" << "] buffer too small. pdu_size=" << pdu_size << " buffer_len=" << buffer_len << std::endl;
-            return -1;
-        }
-        void* top_ptr = hako_get_top_ptr_pdu((void*)base_ptr);
-        if (top_ptr == nullptr) {
-            std::cerr << "[ConvertorError][" << "ServiceRequestHeader" << "] hako_get_top_ptr_pdu returned null" << std::endl;
-            return -1;
-        }
-        memcpy(pdu_buffer, top_ptr, pdu_size);
-        hako_destroy_pdu((void*)base_ptr);
-        return pdu_size;
-    }
-
-private:
 };
 }
 
-
 #endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_ServiceRequestHeader_HPP_ */
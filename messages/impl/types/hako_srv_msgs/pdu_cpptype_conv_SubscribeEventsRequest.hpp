@@ -0,0 +1,85 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsRequest_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsRequest.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_SubscribeEventsRequest.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/SubscribeEventsRequest.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_SubscribeEventsRequest) == 128, "Hako_SubscribeEventsRequest size does not match SubscribeEventsRequest.offset");
+static_assert(offsetof(Hako_SubscribeEventsRequest, name) == 0 && sizeof(Hako_SubscribeEventsRequest::name) == 128,
+              "Hako_SubscribeEventsRequest::name does not match SubscribeEventsRequest.offset");
+
+template <>
+struct HakoPduLayout<Hako_SubscribeEventsRequest> {
+    using cpp_type = HakoCpp_SubscribeEventsRequest;
+    static constexpr const char* name = "SubscribeEventsRequest";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_SubscribeEventsRequest::name, &HakoCpp_SubscribeEventsRequest::name)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_SubscribeEventsRequest(const char* heap_ptr, Hako_SubscribeEventsRequest &src, HakoCpp_SubscribeEventsRequest &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_SubscribeEventsRequest(Hako_SubscribeEventsRequest &src, HakoCpp_SubscribeEventsRequest &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_SubscribeEventsRequest(HakoCpp_SubscribeEventsRequest &src, Hako_SubscribeEventsRequest &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_SubscribeEventsRequest(HakoCpp_SubscribeEventsRequest &src, Hako_SubscribeEventsRequest** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_SubscribeEventsRequest* hako_create_empty_pdu_SubscribeEventsRequest(int heap_size)
+{
+    return (Hako_SubscribeEventsRequest*)hako_create_empty_pdu(sizeof(Hako_SubscribeEventsRequest), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class SubscribeEventsRequest : public HakoPduLayoutConvertor<Hako_SubscribeEventsRequest>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsRequest_HPP_ */
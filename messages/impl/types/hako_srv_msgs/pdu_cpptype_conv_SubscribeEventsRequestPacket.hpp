@@ -0,0 +1,90 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsRequestPacket.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_SubscribeEventsRequestPacket.hpp"
+
+/*
+ * Dependent Convertors
+ */
+#include "hako_srv_msgs/pdu_cpptype_conv_ServiceRequestHeader.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_SubscribeEventsRequest.hpp"
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/SubscribeEventsRequestPacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_SubscribeEventsRequestPacket) == 396, "Hako_SubscribeEventsRequestPacket size does not match SubscribeEventsRequestPacket.offset");
+static_assert(offsetof(Hako_SubscribeEventsRequestPacket, header) == 0 && sizeof(Hako_SubscribeEventsRequestPacket::header) == 268,
+              "Hako_SubscribeEventsRequestPacket::header does not match SubscribeEventsRequestPacket.offset");
+static_assert(offsetof(Hako_SubscribeEventsRequestPacket, body) == 268 && sizeof(Hako_SubscribeEventsRequestPacket::body) == 128,
+              "Hako_SubscribeEventsRequestPacket::body does not match SubscribeEventsRequestPacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_SubscribeEventsRequestPacket> {
+    using cpp_type = HakoCpp_SubscribeEventsRequestPacket;
+    static constexpr const char* name = "SubscribeEventsRequestPacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_SubscribeEventsRequestPacket::header, &HakoCpp_SubscribeEventsRequestPacket::header),
+        hako_pdu_field(&Hako_SubscribeEventsRequestPacket::body, &HakoCpp_SubscribeEventsRequestPacket::body)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_SubscribeEventsRequestPacket(const char* heap_ptr, Hako_SubscribeEventsRequestPacket &src, HakoCpp_SubscribeEventsRequestPacket &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_SubscribeEventsRequestPacket(Hako_SubscribeEventsRequestPacket &src, HakoCpp_SubscribeEventsRequestPacket &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_SubscribeEventsRequestPacket(HakoCpp_SubscribeEventsRequestPacket &src, Hako_SubscribeEventsRequestPacket &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_SubscribeEventsRequestPacket(HakoCpp_SubscribeEventsRequestPacket &src, Hako_SubscribeEventsRequestPacket** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_SubscribeEventsRequestPacket* hako_create_empty_pdu_SubscribeEventsRequestPacket(int heap_size)
+{
+    return (Hako_SubscribeEventsRequestPacket*)hako_create_empty_pdu(sizeof(Hako_SubscribeEventsRequestPacket), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class SubscribeEventsRequestPacket : public HakoPduLayoutConvertor<Hako_SubscribeEventsRequestPacket>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_ */
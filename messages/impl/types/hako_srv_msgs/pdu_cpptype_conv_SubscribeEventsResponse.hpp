@@ -0,0 +1,85 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsResponse_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsResponse.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_SubscribeEventsResponse.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/SubscribeEventsResponse.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_SubscribeEventsResponse) == 4, "Hako_SubscribeEventsResponse size does not match SubscribeEventsResponse.offset");
+static_assert(offsetof(Hako_SubscribeEventsResponse, event_code) == 0 && sizeof(Hako_SubscribeEventsResponse::event_code) == 4,
+              "Hako_SubscribeEventsResponse::event_code does not match SubscribeEventsResponse.offset");
+
+template <>
+struct HakoPduLayout<Hako_SubscribeEventsResponse> {
+    using cpp_type = HakoCpp_SubscribeEventsResponse;
+    static constexpr const char* name = "SubscribeEventsResponse";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_SubscribeEventsResponse::event_code, &HakoCpp_SubscribeEventsResponse::event_code)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_SubscribeEventsResponse(const char* heap_ptr, Hako_SubscribeEventsResponse &src, HakoCpp_SubscribeEventsResponse &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_SubscribeEventsResponse(Hako_SubscribeEventsResponse &src, HakoCpp_SubscribeEventsResponse &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_SubscribeEventsResponse(HakoCpp_SubscribeEventsResponse &src, Hako_SubscribeEventsResponse &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_SubscribeEventsResponse(HakoCpp_SubscribeEventsResponse &src, Hako_SubscribeEventsResponse** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_SubscribeEventsResponse* hako_create_empty_pdu_SubscribeEventsResponse(int heap_size)
+{
+    return (Hako_SubscribeEventsResponse*)hako_create_empty_pdu(sizeof(Hako_SubscribeEventsResponse), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class SubscribeEventsResponse : public HakoPduLayoutConvertor<Hako_SubscribeEventsResponse>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsResponse_HPP_ */
@@ -0,0 +1,90 @@
+#ifndef _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsResponsePacket_HPP_
+#define _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+#include "hako_srv_msgs/pdu_cpplayout_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsResponsePacket.h"
+/*
+ * Dependent cpp pdu data
+ */
+#include "hako_srv_msgs/pdu_cpptype_SubscribeEventsResponsePacket.hpp"
+
+/*
+ * Dependent Convertors
+ */
+#include "hako_srv_msgs/pdu_cpptype_conv_ServiceResponseHeader.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_SubscribeEventsResponse.hpp"
+
+/***************************
+ *
+ * Layout (hako_srv_msgs/SubscribeEventsResponsePacket.offset)
+ *
+ ***************************/
+
+static_assert(sizeof(Hako_SubscribeEventsResponsePacket) == 272, "Hako_SubscribeEventsResponsePacket size does not match SubscribeEventsResponsePacket.offset");
+static_assert(offsetof(Hako_SubscribeEventsResponsePacket, header) == 0 && sizeof(Hako_SubscribeEventsResponsePacket::header) == 268,
+              "Hako_SubscribeEventsResponsePacket::header does not match SubscribeEventsResponsePacket.offset");
+static_assert(offsetof(Hako_SubscribeEventsResponsePacket, body) == 268 && sizeof(Hako_SubscribeEventsResponsePacket::body) == 4,
+              "Hako_SubscribeEventsResponsePacket::body does not match SubscribeEventsResponsePacket.offset");
+
+template <>
+struct HakoPduLayout<Hako_SubscribeEventsResponsePacket> {
+    using cpp_type = HakoCpp_SubscribeEventsResponsePacket;
+    static constexpr const char* name = "SubscribeEventsResponsePacket";
+    static constexpr auto fields = std::make_tuple(
+        hako_pdu_field(&Hako_SubscribeEventsResponsePacket::header, &HakoCpp_SubscribeEventsResponsePacket::header),
+        hako_pdu_field(&Hako_SubscribeEventsResponsePacket::body, &HakoCpp_SubscribeEventsResponsePacket::body)
+    );
+};
+
+/***************************
+ *
+ * PDU ==> CPP PDU
+ *
+ ***************************/
+
+static inline int cpp_pdu2cpp_SubscribeEventsResponsePacket(const char* heap_ptr, Hako_SubscribeEventsResponsePacket &src, HakoCpp_SubscribeEventsResponsePacket &dst)
+{
+    return hako_cpplayout_pdu2cpp(heap_ptr, src, dst);
+}
+
+static inline int hako_convert_pdu2cpp_SubscribeEventsResponsePacket(Hako_SubscribeEventsResponsePacket &src, HakoCpp_SubscribeEventsResponsePacket &dst)
+{
+    return hako_cpplayout_convert_pdu2cpp(src, dst);
+}
+
+/***************************
+ *
+ * CPP PDU ==> PDU
+ *
+ ***************************/
+
+static inline bool cpp_cpp2pdu_SubscribeEventsResponsePacket(HakoCpp_SubscribeEventsResponsePacket &src, Hako_SubscribeEventsResponsePacket &dst, PduDynamicMemory &dynamic_memory)
+{
+    (void)dynamic_memory; // a layout has no heap section
+    return hako_cpplayout_cpp2pdu(src, dst);
+}
+
+static inline int hako_convert_cpp2pdu_SubscribeEventsResponsePacket(HakoCpp_SubscribeEventsResponsePacket &src, Hako_SubscribeEventsResponsePacket** dst)
+{
+    return hako_cpplayout_convert_cpp2pdu(src, dst);
+}
+
+static inline Hako_SubscribeEventsResponsePacket* hako_create_empty_pdu_SubscribeEventsResponsePacket(int heap_size)
+{
+    return (Hako_SubscribeEventsResponsePacket*)hako_create_empty_pdu(sizeof(Hako_SubscribeEventsResponsePacket), heap_size);
+}
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+class SubscribeEventsResponsePacket : public HakoPduLayoutConvertor<Hako_SubscribeEventsResponsePacket>
+{
+};
+}
+
+#endif /* _PDU_CPPTYPE_CONV_HAKO_hako_srv_msgs_SubscribeEventsResponsePacket_HPP_ */
@@ -0,0 +1,42 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_AckEventRequest_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_AckEventRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_AckEventRequest.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_AckEventRequest in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class AckEventRequestView
+{
+public:
+    explicit AckEventRequestView(const Hako_AckEventRequest& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<AckEventRequestView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_AckEventRequest* base = hako_cppview_base<Hako_AckEventRequest>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return AckEventRequestView(*base);
+    }
+
+    std::string_view name() const { return hako_cppview_string(base_->name); }
+    Hako_uint32 event_code() const { return base_->event_code; }
+    Hako_uint32 result_code() const { return base_->result_code; }
+
+private:
+    const Hako_AckEventRequest* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_AckEventRequest_HPP_ */
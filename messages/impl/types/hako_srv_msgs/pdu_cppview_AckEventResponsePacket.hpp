@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_AckEventResponsePacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_AckEventResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_AckEventResponsePacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_AckEventResponse.hpp"
+#include "hako_srv_msgs/pdu_cppview_ServiceResponseHeader.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_AckEventResponsePacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class AckEventResponsePacketView
+{
+public:
+    explicit AckEventResponsePacketView(const Hako_AckEventResponsePacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<AckEventResponsePacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_AckEventResponsePacket* base = hako_cppview_base<Hako_AckEventResponsePacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return AckEventResponsePacketView(*base);
+    }
+
+    ServiceResponseHeaderView header() const { return ServiceResponseHeaderView(base_->header); }
+    AckEventResponseView body() const { return AckEventResponseView(base_->body); }
+
+private:
+    const Hako_AckEventResponsePacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_AckEventResponsePacket_HPP_ */
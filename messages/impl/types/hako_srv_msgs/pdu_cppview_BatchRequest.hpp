@@ -0,0 +1,44 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchRequest_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchRequest.h"
+#include <span>
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_BatchRequest in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class BatchRequestView
+{
+public:
+    explicit BatchRequestView(const Hako_BatchRequest& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<BatchRequestView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_BatchRequest* base = hako_cppview_base<Hako_BatchRequest>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return BatchRequestView(*base);
+    }
+
+    std::string_view name() const { return hako_cppview_string(base_->name); }
+    Hako_uint32 op_count() const { return base_->op_count; }
+    std::span<const Hako_uint32, 8> ops() const { return std::span<const Hako_uint32, 8>(base_->ops); }
+    std::span<const Hako_uint32, 8> args() const { return std::span<const Hako_uint32, 8>(base_->args); }
+
+private:
+    const Hako_BatchRequest* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchRequest_HPP_ */
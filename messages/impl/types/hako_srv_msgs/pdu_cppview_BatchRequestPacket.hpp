@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchRequestPacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchRequestPacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_BatchRequest.hpp"
+#include "hako_srv_msgs/pdu_cppview_ServiceRequestHeader.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_BatchRequestPacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class BatchRequestPacketView
+{
+public:
+    explicit BatchRequestPacketView(const Hako_BatchRequestPacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<BatchRequestPacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_BatchRequestPacket* base = hako_cppview_base<Hako_BatchRequestPacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return BatchRequestPacketView(*base);
+    }
+
+    ServiceRequestHeaderView header() const { return ServiceRequestHeaderView(base_->header); }
+    BatchRequestView body() const { return BatchRequestView(base_->body); }
+
+private:
+    const Hako_BatchRequestPacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchRequestPacket_HPP_ */
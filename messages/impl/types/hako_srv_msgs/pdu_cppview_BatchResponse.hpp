@@ -0,0 +1,47 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchResponse_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchResponse.h"
+#include <span>
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_BatchResponse in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class BatchResponseView
+{
+public:
+    explicit BatchResponseView(const Hako_BatchResponse& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<BatchResponseView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_BatchResponse* base = hako_cppview_base<Hako_BatchResponse>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return BatchResponseView(*base);
+    }
+
+    Hako_uint32 op_count() const { return base_->op_count; }
+    std::span<const Hako_int32, 8> result_codes() const { return std::span<const Hako_int32, 8>(base_->result_codes); }
+    std::span<const Hako_uint32, 8> values() const { return std::span<const Hako_uint32, 8>(base_->values); }
+    Hako_int64 master_time() const { return base_->master_time; }
+    bool is_pdu_created() const { return base_->is_pdu_created != 0; }
+    bool is_simulation_mode() const { return base_->is_simulation_mode != 0; }
+    bool is_pdu_sync_mode() const { return base_->is_pdu_sync_mode != 0; }
+
+private:
+    const Hako_BatchResponse* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchResponse_HPP_ */
@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchResponsePacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchResponsePacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_BatchResponse.hpp"
+#include "hako_srv_msgs/pdu_cppview_ServiceResponseHeader.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_BatchResponsePacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class BatchResponsePacketView
+{
+public:
+    explicit BatchResponsePacketView(const Hako_BatchResponsePacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<BatchResponsePacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_BatchResponsePacket* base = hako_cppview_base<Hako_BatchResponsePacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return BatchResponsePacketView(*base);
+    }
+
+    ServiceResponseHeaderView header() const { return ServiceResponseHeaderView(base_->header); }
+    BatchResponseView body() const { return BatchResponseView(base_->body); }
+
+private:
+    const Hako_BatchResponsePacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_BatchResponsePacket_HPP_ */
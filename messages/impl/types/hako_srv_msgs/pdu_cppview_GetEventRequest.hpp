@@ -0,0 +1,41 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetEventRequest_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetEventRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetEventRequest.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetEventRequest in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetEventRequestView
+{
+public:
+    explicit GetEventRequestView(const Hako_GetEventRequest& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetEventRequestView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetEventRequest* base = hako_cppview_base<Hako_GetEventRequest>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetEventRequestView(*base);
+    }
+
+    std::string_view name() const { return hako_cppview_string(base_->name); }
+    Hako_uint32 wait_timeout_msec() const { return base_->wait_timeout_msec; }
+
+private:
+    const Hako_GetEventRequest* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetEventRequest_HPP_ */
@@ -0,0 +1,40 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetEventResponse_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetEventResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetEventResponse.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetEventResponse in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetEventResponseView
+{
+public:
+    explicit GetEventResponseView(const Hako_GetEventResponse& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetEventResponseView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetEventResponse* base = hako_cppview_base<Hako_GetEventResponse>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetEventResponseView(*base);
+    }
+
+    Hako_uint32 event_code() const { return base_->event_code; }
+
+private:
+    const Hako_GetEventResponse* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetEventResponse_HPP_ */
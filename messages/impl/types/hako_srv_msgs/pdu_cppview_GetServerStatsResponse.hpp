@@ -0,0 +1,58 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsResponse.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetServerStatsResponse in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetServerStatsResponseView
+{
+public:
+    explicit GetServerStatsResponseView(const Hako_GetServerStatsResponse& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetServerStatsResponseView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetServerStatsResponse* base = hako_cppview_base<Hako_GetServerStatsResponse>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetServerStatsResponseView(*base);
+    }
+
+    std::string_view service_name() const { return hako_cppview_string(base_->service_name); }
+    Hako_uint64 count() const { return base_->count; }
+    Hako_uint64 rejected() const { return base_->rejected; }
+    Hako_uint64 queue_wait_p50_usec() const { return base_->queue_wait_p50_usec; }
+    Hako_uint64 queue_wait_p99_usec() const { return base_->queue_wait_p99_usec; }
+    Hako_uint64 queue_wait_p999_usec() const { return base_->queue_wait_p999_usec; }
+    Hako_uint64 queue_wait_max_usec() const { return base_->queue_wait_max_usec; }
+    Hako_uint64 handler_p50_usec() const { return base_->handler_p50_usec; }
+    Hako_uint64 handler_p99_usec() const { return base_->handler_p99_usec; }
+    Hako_uint64 handler_p999_usec() const { return base_->handler_p999_usec; }
+    Hako_uint64 handler_max_usec() const { return base_->handler_max_usec; }
+    Hako_uint64 reply_p50_usec() const { return base_->reply_p50_usec; }
+    Hako_uint64 reply_p99_usec() const { return base_->reply_p99_usec; }
+    Hako_uint64 reply_p999_usec() const { return base_->reply_p999_usec; }
+    Hako_uint64 reply_max_usec() const { return base_->reply_max_usec; }
+    Hako_uint64 total_p50_usec() const { return base_->total_p50_usec; }
+    Hako_uint64 total_p99_usec() const { return base_->total_p99_usec; }
+    Hako_uint64 total_p999_usec() const { return base_->total_p999_usec; }
+    Hako_uint64 total_max_usec() const { return base_->total_max_usec; }
+
+private:
+    const Hako_GetServerStatsResponse* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_ */
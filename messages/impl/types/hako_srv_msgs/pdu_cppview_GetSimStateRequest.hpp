@@ -0,0 +1,40 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateRequest_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetSimStateRequest.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetSimStateRequest in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetSimStateRequestView
+{
+public:
+    explicit GetSimStateRequestView(const Hako_GetSimStateRequest& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetSimStateRequestView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetSimStateRequest* base = hako_cppview_base<Hako_GetSimStateRequest>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetSimStateRequestView(*base);
+    }
+
+    std::string_view name() const { return hako_cppview_string(base_->name); }
+
+private:
+    const Hako_GetSimStateRequest* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateRequest_HPP_ */
@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateRequestPacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetSimStateRequestPacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_GetSimStateRequest.hpp"
+#include "hako_srv_msgs/pdu_cppview_ServiceRequestHeader.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetSimStateRequestPacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetSimStateRequestPacketView
+{
+public:
+    explicit GetSimStateRequestPacketView(const Hako_GetSimStateRequestPacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetSimStateRequestPacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetSimStateRequestPacket* base = hako_cppview_base<Hako_GetSimStateRequestPacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetSimStateRequestPacketView(*base);
+    }
+
+    ServiceRequestHeaderView header() const { return ServiceRequestHeaderView(base_->header); }
+    GetSimStateRequestView body() const { return GetSimStateRequestView(base_->body); }
+
+private:
+    const Hako_GetSimStateRequestPacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateRequestPacket_HPP_ */
@@ -0,0 +1,44 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateResponse_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetSimStateResponse.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetSimStateResponse in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetSimStateResponseView
+{
+public:
+    explicit GetSimStateResponseView(const Hako_GetSimStateResponse& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetSimStateResponseView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetSimStateResponse* base = hako_cppview_base<Hako_GetSimStateResponse>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetSimStateResponseView(*base);
+    }
+
+    Hako_uint32 sim_state() const { return base_->sim_state; }
+    Hako_int64 master_time() const { return base_->master_time; }
+    bool is_pdu_created() const { return base_->is_pdu_created != 0; }
+    bool is_simulation_mode() const { return base_->is_simulation_mode != 0; }
+    bool is_pdu_sync_mode() const { return base_->is_pdu_sync_mode != 0; }
+
+private:
+    const Hako_GetSimStateResponse* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateResponse_HPP_ */
@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateResponsePacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetSimStateResponsePacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_GetSimStateResponse.hpp"
+#include "hako_srv_msgs/pdu_cppview_ServiceResponseHeader.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_GetSimStateResponsePacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class GetSimStateResponsePacketView
+{
+public:
+    explicit GetSimStateResponsePacketView(const Hako_GetSimStateResponsePacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<GetSimStateResponsePacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_GetSimStateResponsePacket* base = hako_cppview_base<Hako_GetSimStateResponsePacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return GetSimStateResponsePacketView(*base);
+    }
+
+    ServiceResponseHeaderView header() const { return ServiceResponseHeaderView(base_->header); }
+    GetSimStateResponseView body() const { return GetSimStateResponseView(base_->body); }
+
+private:
+    const Hako_GetSimStateResponsePacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_GetSimStateResponsePacket_HPP_ */
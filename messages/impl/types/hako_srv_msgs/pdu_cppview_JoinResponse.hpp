@@ -0,0 +1,42 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_JoinResponse_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_JoinResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_JoinResponse.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_JoinResponse in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class JoinResponseView
+{
+public:
+    explicit JoinResponseView(const Hako_JoinResponse& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<JoinResponseView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_JoinResponse* base = hako_cppview_base<Hako_JoinResponse>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return JoinResponseView(*base);
+    }
+
+    Hako_uint32 status_code() const { return base_->status_code; }
+    std::string_view message() const { return hako_cppview_string(base_->message); }
+    Hako_uint64 session_token() const { return base_->session_token; }
+
+private:
+    const Hako_JoinResponse* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_JoinResponse_HPP_ */
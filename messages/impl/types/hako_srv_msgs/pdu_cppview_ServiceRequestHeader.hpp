@@ -0,0 +1,44 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_ServiceRequestHeader_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_ServiceRequestHeader_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_ServiceRequestHeader.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_ServiceRequestHeader in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class ServiceRequestHeaderView
+{
+public:
+    explicit ServiceRequestHeaderView(const Hako_ServiceRequestHeader& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<ServiceRequestHeaderView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_ServiceRequestHeader* base = hako_cppview_base<Hako_ServiceRequestHeader>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return ServiceRequestHeaderView(*base);
+    }
+
+    Hako_uint32 request_id() const { return base_->request_id; }
+    std::string_view service_name() const { return hako_cppview_string(base_->service_name); }
+    std::string_view client_name() const { return hako_cppview_string(base_->client_name); }
+    Hako_uint8 opcode() const { return base_->opcode; }
+    Hako_int32 status_poll_interval_msec() const { return base_->status_poll_interval_msec; }
+
+private:
+    const Hako_ServiceRequestHeader* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_ServiceRequestHeader_HPP_ */
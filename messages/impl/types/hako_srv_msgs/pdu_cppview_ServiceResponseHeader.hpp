@@ -0,0 +1,45 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_ServiceResponseHeader_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_ServiceResponseHeader_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_ServiceResponseHeader.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_ServiceResponseHeader in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class ServiceResponseHeaderView
+{
+public:
+    explicit ServiceResponseHeaderView(const Hako_ServiceResponseHeader& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<ServiceResponseHeaderView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_ServiceResponseHeader* base = hako_cppview_base<Hako_ServiceResponseHeader>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return ServiceResponseHeaderView(*base);
+    }
+
+    Hako_uint32 request_id() const { return base_->request_id; }
+    std::string_view service_name() const { return hako_cppview_string(base_->service_name); }
+    std::string_view client_name() const { return hako_cppview_string(base_->client_name); }
+    Hako_uint8 status() const { return base_->status; }
+    Hako_uint8 processing_percentage() const { return base_->processing_percentage; }
+    Hako_int32 result_code() const { return base_->result_code; }
+
+private:
+    const Hako_ServiceResponseHeader* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_ServiceResponseHeader_HPP_ */
@@ -0,0 +1,41 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_SimControlRequest_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_SimControlRequest_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SimControlRequest.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_SimControlRequest in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class SimControlRequestView
+{
+public:
+    explicit SimControlRequestView(const Hako_SimControlRequest& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<SimControlRequestView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_SimControlRequest* base = hako_cppview_base<Hako_SimControlRequest>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return SimControlRequestView(*base);
+    }
+
+    std::string_view name() const { return hako_cppview_string(base_->name); }
+    Hako_uint32 op() const { return base_->op; }
+
+private:
+    const Hako_SimControlRequest* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_SimControlRequest_HPP_ */
@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_SimControlResponsePacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_SimControlResponsePacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SimControlResponsePacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_ServiceResponseHeader.hpp"
+#include "hako_srv_msgs/pdu_cppview_SimControlResponse.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_SimControlResponsePacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class SimControlResponsePacketView
+{
+public:
+    explicit SimControlResponsePacketView(const Hako_SimControlResponsePacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<SimControlResponsePacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_SimControlResponsePacket* base = hako_cppview_base<Hako_SimControlResponsePacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return SimControlResponsePacketView(*base);
+    }
+
+    ServiceResponseHeaderView header() const { return ServiceResponseHeaderView(base_->header); }
+    SimControlResponseView body() const { return SimControlResponseView(base_->body); }
+
+private:
+    const Hako_SimControlResponsePacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_SimControlResponsePacket_HPP_ */
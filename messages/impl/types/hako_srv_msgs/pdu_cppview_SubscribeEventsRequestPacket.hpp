@@ -0,0 +1,46 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsRequestPacket.h"
+/*
+ * Dependent views
+ */
+#include "hako_srv_msgs/pdu_cppview_ServiceRequestHeader.hpp"
+#include "hako_srv_msgs/pdu_cppview_SubscribeEventsRequest.hpp"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_SubscribeEventsRequestPacket in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class SubscribeEventsRequestPacketView
+{
+public:
+    explicit SubscribeEventsRequestPacketView(const Hako_SubscribeEventsRequestPacket& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<SubscribeEventsRequestPacketView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_SubscribeEventsRequestPacket* base = hako_cppview_base<Hako_SubscribeEventsRequestPacket>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return SubscribeEventsRequestPacketView(*base);
+    }
+
+    ServiceRequestHeaderView header() const { return ServiceRequestHeaderView(base_->header); }
+    SubscribeEventsRequestView body() const { return SubscribeEventsRequestView(base_->body); }
+
+private:
+    const Hako_SubscribeEventsRequestPacket* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_SubscribeEventsRequestPacket_HPP_ */
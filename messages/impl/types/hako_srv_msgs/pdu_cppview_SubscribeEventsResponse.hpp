@@ -0,0 +1,40 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_SubscribeEventsResponse_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_SubscribeEventsResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_cppview_primitives.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsResponse.h"
+
+namespace hako::pdu::msgs::hako_srv_msgs
+{
+/*
+ * Read-only view of Hako_SubscribeEventsResponse in a received PDU buffer.
+ * Fields are read in place and strings come back as std::string_view
+ * into the buffer, so a view must not outlive that buffer.
+ */
+class SubscribeEventsResponseView
+{
+public:
+    explicit SubscribeEventsResponseView(const Hako_SubscribeEventsResponse& base) : base_(&base) {}
+
+    // nullopt unless top_ptr/len holds a whole PDU of this type
+    static std::optional<SubscribeEventsResponseView> from_pdu(const char* top_ptr, size_t len)
+    {
+        const Hako_SubscribeEventsResponse* base = hako_cppview_base<Hako_SubscribeEventsResponse>(top_ptr, len);
+        if (base == nullptr) {
+            return std::nullopt;
+        }
+        return SubscribeEventsResponseView(*base);
+    }
+
+    Hako_uint32 event_code() const { return base_->event_code; }
+
+private:
+    const Hako_SubscribeEventsResponse* base_;
+};
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_SubscribeEventsResponse_HPP_ */
@@ -0,0 +1,37 @@
+#ifndef _PDU_CPPVIEW_HAKO_hako_srv_msgs_primitives_HPP_
+#define _PDU_CPPVIEW_HAKO_hako_srv_msgs_primitives_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+/*
+ * Shared helpers of the pdu_cppview_* read-only views.
+ */
+
+// Base data of a T-typed PDU at top_ptr, or nullptr if the metadata is
+// invalid or the base data does not fit in len bytes.
+template <typename T>
+static inline const T* hako_cppview_base(const char* top_ptr, size_t len)
+{
+    if (top_ptr == nullptr || len < HAKO_PDU_METADATA_SIZE + sizeof(T)) {
+        return nullptr;
+    }
+    const char* base_ptr = (const char*)hako_get_base_ptr_pdu((void*)top_ptr);
+    if (base_ptr == nullptr || base_ptr < top_ptr || base_ptr + sizeof(T) > top_ptr + len) {
+        return nullptr;
+    }
+    return (const T*)base_ptr;
+}
+
+// A string field up to its NUL, or the whole field if it has none.
+template <size_t N>
+static inline std::string_view hako_cppview_string(const char (&field)[N])
+{
+    const void* nul = memchr(field, '\0', N);
+    return std::string_view(field, (nul != nullptr) ? (size_t)((const char*)nul - field) : N);
+}
+
+#endif /* _PDU_CPPVIEW_HAKO_hako_srv_msgs_primitives_HPP_ */
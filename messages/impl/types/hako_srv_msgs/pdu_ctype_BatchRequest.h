@@ -0,0 +1,13 @@
+#ifndef _pdu_ctype_hako_srv_msgs_BatchRequest_H_
+#define _pdu_ctype_hako_srv_msgs_BatchRequest_H_
+
+#include "pdu_primitive_ctypes.h"
+
+typedef struct {
+        char name[HAKO_STRING_SIZE];
+        Hako_uint32 op_count;
+        Hako_uint32 ops[8];
+        Hako_uint32 args[8];
+} Hako_BatchRequest;
+
+#endif /* _pdu_ctype_hako_srv_msgs_BatchRequest_H_ */
@@ -0,0 +1,13 @@
+#ifndef _pdu_ctype_hako_srv_msgs_BatchRequestPacket_H_
+#define _pdu_ctype_hako_srv_msgs_BatchRequestPacket_H_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_ctype_BatchRequest.h"
+#include "hako_srv_msgs/pdu_ctype_ServiceRequestHeader.h"
+
+typedef struct {
+        Hako_ServiceRequestHeader header;
+        Hako_BatchRequest body;
+} Hako_BatchRequestPacket;
+
+#endif /* _pdu_ctype_hako_srv_msgs_BatchRequestPacket_H_ */
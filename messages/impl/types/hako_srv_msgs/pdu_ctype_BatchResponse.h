@@ -0,0 +1,16 @@
+#ifndef _pdu_ctype_hako_srv_msgs_BatchResponse_H_
+#define _pdu_ctype_hako_srv_msgs_BatchResponse_H_
+
+#include "pdu_primitive_ctypes.h"
+
+typedef struct {
+        Hako_uint32 op_count;
+        Hako_int32 result_codes[8];
+        Hako_uint32 values[8];
+        Hako_int64 master_time;
+        Hako_bool is_pdu_created;
+        Hako_bool is_simulation_mode;
+        Hako_bool is_pdu_sync_mode;
+} Hako_BatchResponse;
+
+#endif /* _pdu_ctype_hako_srv_msgs_BatchResponse_H_ */
@@ -0,0 +1,13 @@
+#ifndef _pdu_ctype_hako_srv_msgs_BatchResponsePacket_H_
+#define _pdu_ctype_hako_srv_msgs_BatchResponsePacket_H_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_ctype_BatchResponse.h"
+#include "hako_srv_msgs/pdu_ctype_ServiceResponseHeader.h"
+
+typedef struct {
+        Hako_ServiceResponseHeader header;
+        Hako_BatchResponse body;
+} Hako_BatchResponsePacket;
+
+#endif /* _pdu_ctype_hako_srv_msgs_BatchResponsePacket_H_ */
@@ -5,6 +5,7 @@
 
 typedef struct {
         char name[HAKO_STRING_SIZE];
+        Hako_uint32 wait_timeout_msec;
 } Hako_GetEventRequest;
 
 #endif /* _pdu_ctype_hako_srv_msgs_GetEventRequest_H_ */
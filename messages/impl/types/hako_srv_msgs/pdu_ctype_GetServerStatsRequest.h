@@ -0,0 +1,11 @@
+#ifndef _pdu_ctype_hako_srv_msgs_GetServerStatsRequest_H_
+#define _pdu_ctype_hako_srv_msgs_GetServerStatsRequest_H_
+
+#include "pdu_primitive_ctypes.h"
+
+typedef struct {
+        char name[HAKO_STRING_SIZE];
+        char service_name[HAKO_STRING_SIZE];
+} Hako_GetServerStatsRequest;
+
+#endif /* _pdu_ctype_hako_srv_msgs_GetServerStatsRequest_H_ */
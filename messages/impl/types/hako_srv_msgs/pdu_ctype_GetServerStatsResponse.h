@@ -0,0 +1,28 @@
+#ifndef _pdu_ctype_hako_srv_msgs_GetServerStatsResponse_H_
+#define _pdu_ctype_hako_srv_msgs_GetServerStatsResponse_H_
+
+#include "pdu_primitive_ctypes.h"
+
+typedef struct {
+        char service_name[HAKO_STRING_SIZE];
+        Hako_uint64 count;
+        Hako_uint64 rejected;
+        Hako_uint64 queue_wait_p50_usec;
+        Hako_uint64 queue_wait_p99_usec;
+        Hako_uint64 queue_wait_p999_usec;
+        Hako_uint64 queue_wait_max_usec;
+        Hako_uint64 handler_p50_usec;
+        Hako_uint64 handler_p99_usec;
+        Hako_uint64 handler_p999_usec;
+        Hako_uint64 handler_max_usec;
+        Hako_uint64 reply_p50_usec;
+        Hako_uint64 reply_p99_usec;
+        Hako_uint64 reply_p999_usec;
+        Hako_uint64 reply_max_usec;
+        Hako_uint64 total_p50_usec;
+        Hako_uint64 total_p99_usec;
+        Hako_uint64 total_p999_usec;
+        Hako_uint64 total_max_usec;
+} Hako_GetServerStatsResponse;
+
+#endif /* _pdu_ctype_hako_srv_msgs_GetServerStatsResponse_H_ */
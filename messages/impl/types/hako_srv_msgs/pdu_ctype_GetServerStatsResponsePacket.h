@@ -0,0 +1,13 @@
+#ifndef _pdu_ctype_hako_srv_msgs_GetServerStatsResponsePacket_H_
+#define _pdu_ctype_hako_srv_msgs_GetServerStatsResponsePacket_H_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsResponse.h"
+#include "hako_srv_msgs/pdu_ctype_ServiceResponseHeader.h"
+
+typedef struct {
+        Hako_ServiceResponseHeader header;
+        Hako_GetServerStatsResponse body;
+} Hako_GetServerStatsResponsePacket;
+
+#endif /* _pdu_ctype_hako_srv_msgs_GetServerStatsResponsePacket_H_ */
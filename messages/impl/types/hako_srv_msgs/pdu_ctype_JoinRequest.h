@@ -5,6 +5,7 @@
 
 typedef struct {
         char name[HAKO_STRING_SIZE];
+        Hako_uint64 session_token;
 } Hako_JoinRequest;
 
 #endif /* _pdu_ctype_hako_srv_msgs_JoinRequest_H_ */
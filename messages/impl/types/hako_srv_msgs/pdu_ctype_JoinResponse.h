@@ -6,6 +6,7 @@
 typedef struct {
         Hako_uint32 status_code;
         char message[HAKO_STRING_SIZE];
+        Hako_uint64 session_token;
 } Hako_JoinResponse;
 
 #endif /* _pdu_ctype_hako_srv_msgs_JoinResponse_H_ */
@@ -0,0 +1,10 @@
+#ifndef _pdu_ctype_hako_srv_msgs_SubscribeEventsRequest_H_
+#define _pdu_ctype_hako_srv_msgs_SubscribeEventsRequest_H_
+
+#include "pdu_primitive_ctypes.h"
+
+typedef struct {
+        char name[HAKO_STRING_SIZE];
+} Hako_SubscribeEventsRequest;
+
+#endif /* _pdu_ctype_hako_srv_msgs_SubscribeEventsRequest_H_ */
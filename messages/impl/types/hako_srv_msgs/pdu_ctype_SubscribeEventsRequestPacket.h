@@ -0,0 +1,13 @@
+#ifndef _pdu_ctype_hako_srv_msgs_SubscribeEventsRequestPacket_H_
+#define _pdu_ctype_hako_srv_msgs_SubscribeEventsRequestPacket_H_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_ctype_ServiceRequestHeader.h"
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsRequest.h"
+
+typedef struct {
+        Hako_ServiceRequestHeader header;
+        Hako_SubscribeEventsRequest body;
+} Hako_SubscribeEventsRequestPacket;
+
+#endif /* _pdu_ctype_hako_srv_msgs_SubscribeEventsRequestPacket_H_ */
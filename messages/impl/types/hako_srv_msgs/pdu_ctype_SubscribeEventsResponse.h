@@ -0,0 +1,10 @@
+#ifndef _pdu_ctype_hako_srv_msgs_SubscribeEventsResponse_H_
+#define _pdu_ctype_hako_srv_msgs_SubscribeEventsResponse_H_
+
+#include "pdu_primitive_ctypes.h"
+
+typedef struct {
+        Hako_uint32 event_code;
+} Hako_SubscribeEventsResponse;
+
+#endif /* _pdu_ctype_hako_srv_msgs_SubscribeEventsResponse_H_ */
@@ -0,0 +1,13 @@
+#ifndef _pdu_ctype_hako_srv_msgs_SubscribeEventsResponsePacket_H_
+#define _pdu_ctype_hako_srv_msgs_SubscribeEventsResponsePacket_H_
+
+#include "pdu_primitive_ctypes.h"
+#include "hako_srv_msgs/pdu_ctype_ServiceResponseHeader.h"
+#include "hako_srv_msgs/pdu_ctype_SubscribeEventsResponse.h"
+
+typedef struct {
+        Hako_ServiceResponseHeader header;
+        Hako_SubscribeEventsResponse body;
+} Hako_SubscribeEventsResponsePacket;
+
+#endif /* _pdu_ctype_hako_srv_msgs_SubscribeEventsResponsePacket_H_ */
@@ -0,0 +1,131 @@
+#ifndef _PDU_CTYPE_CONV_HAKO_hako_srv_msgs_BatchResponse_HPP_
+#define _PDU_CTYPE_CONV_HAKO_hako_srv_msgs_BatchResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "ros_primitive_types.hpp"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_BatchResponse.h"
+/*
+ * Dependent ros data
+ */
+#include "hako_srv_msgs/msg/batch_response.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * PDU ==> ROS2
+ *
+ ***************************/
+
+static inline int _pdu2ros_BatchResponse(const char* heap_ptr, Hako_BatchResponse &src, hako_srv_msgs::msg::BatchResponse &dst)
+{
+    // primitive convert
+    hako_convert_pdu2ros(src.op_count, dst.op_count);
+    // primitive array convertor
+    (void)hako_convert_pdu2ros_array(
+        src.result_codes, M_ARRAY_SIZE(Hako_BatchResponse, Hako_int32, result_codes),
+        dst.result_codes, dst.result_codes.size());
+    // primitive array convertor
+    (void)hako_convert_pdu2ros_array(
+        src.values, M_ARRAY_SIZE(Hako_BatchResponse, Hako_uint32, values),
+        dst.values, dst.values.size());
+    // primitive convert
+    hako_convert_pdu2ros(src.master_time, dst.master_time);
+    // primitive convert
+    hako_convert_pdu2ros(src.is_pdu_created, dst.is_pdu_created);
+    // primitive convert
+    hako_convert_pdu2ros(src.is_simulation_mode, dst.is_simulation_mode);
+    // primitive convert
+    hako_convert_pdu2ros(src.is_pdu_sync_mode, dst.is_pdu_sync_mode);
+    (void)heap_ptr;
+    return 0;
+}
+
+static inline int hako_convert_pdu2ros_BatchResponse(Hako_BatchResponse &src, hako_srv_msgs::msg::BatchResponse &dst)
+{
+    void* base_ptr = (void*)&src;
+    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
+    // Validate magic number and version
+    if (heap_ptr == nullptr) {
+        return -1; // Invalid PDU metadata
+    }
+    else {
+        return _pdu2ros_BatchResponse((char*)heap_ptr, src, dst);
+    }
+}
+
+/***************************
+ *
+ * ROS2 ==> PDU
+ *
+ ***************************/
+
+static inline bool _ros2pdu_BatchResponse(hako_srv_msgs::msg::BatchResponse &src, Hako_BatchResponse &dst, PduDynamicMemory &dynamic_memory)
+{
+    try {
+        // primitive convert
+        hako_convert_ros2pdu(src.op_count, dst.op_count);
+        // primitive array convertor
+        (void)hako_convert_ros2pdu_array(
+            src.result_codes, src.result_codes.size(),
+            dst.result_codes, M_ARRAY_SIZE(Hako_BatchResponse, Hako_int32, result_codes));
+        // primitive array convertor
+        (void)hako_convert_ros2pdu_array(
+            src.values, src.values.size(),
+            dst.values, M_ARRAY_SIZE(Hako_BatchResponse, Hako_uint32, values));
+        // primitive convert
+        hako_convert_ros2pdu(src.master_time, dst.master_time);
+        // primitive convert
+        hako_convert_ros2pdu(src.is_pdu_created, dst.is_pdu_created);
+        // primitive convert
+        hako_convert_ros2pdu(src.is_simulation_mode, dst.is_simulation_mode);
+        // primitive convert
+        hako_convert_ros2pdu(src.is_pdu_sync_mode, dst.is_pdu_sync_mode);
+    } catch (const std::runtime_error& e) {
+        std::cerr << "convertor error: " << e.what() << std::endl;
+        return false;
+    }
+    (void)dynamic_memory;
+    return true;
+}
+
+static inline int hako_convert_ros2pdu_BatchResponse(hako_srv_msgs::msg::BatchResponse &src, Hako_BatchResponse** dst)
+{
+    PduDynamicMemory dynamic_memory;
+    Hako_BatchResponse out;
+    if (!_ros2pdu_BatchResponse(src, out, dynamic_memory)) {
+        return -1;
+    }
+    int heap_size = dynamic_memory.get_total_size();
+    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_BatchResponse), heap_size);
+    if (base_ptr == nullptr) {
+        return -1;
+    }
+    // Copy out on base data
+    memcpy(base_ptr, (void*)&out, sizeof(Hako_BatchResponse));
+
+    // Copy dynamic part and set offsets
+    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
+    dynamic_memory.copy_to_pdu((char*)heap_ptr);
+
+    *dst = (Hako_BatchResponse*)base_ptr;
+    return hako_get_pdu_meta_data(base_ptr)->total_size;
+}
+
+static inline Hako_BatchResponse* hako_create_empty_pdu_BatchResponse(int heap_size)
+{
+    // Allocate PDU memory
+    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_BatchResponse), heap_size);
+    if (base_ptr == nullptr) {
+        return nullptr;
+    }
+    return (Hako_BatchResponse*)base_ptr;
+}
+#endif /* _PDU_CTYPE_CONV_HAKO_hako_srv_msgs_BatchResponse_HPP_ */
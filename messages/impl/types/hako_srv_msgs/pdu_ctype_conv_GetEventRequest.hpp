@@ -28,6 +28,8 @@ static inline int _pdu2ros_GetEventRequest(const char* heap_ptr, Hako_GetEventRe
 {
     // string convertor
     dst.name = (const char*)src.name;
+    // primitive convert
+    hako_convert_pdu2ros(src.wait_timeout_msec, dst.wait_timeout_msec);
     (void)heap_ptr;
     return 0;
 }
@@ -59,6 +61,8 @@ static inline bool _ros2pdu_GetEventRequest(hako_srv_msgs::msg::GetEventRequest
             src.name, src.name.length(),
             dst.name, M_ARRAY_SIZE(Hako_GetEventRequest, char, name));
         dst.name[src.name.length()] = '\0';
+        // primitive convert
+        hako_convert_ros2pdu(src.wait_timeout_msec, dst.wait_timeout_msec);
     } catch (const std::runtime_error& e) {
         std::cerr << "convertor error: " << e.what() << std::endl;
         return false;
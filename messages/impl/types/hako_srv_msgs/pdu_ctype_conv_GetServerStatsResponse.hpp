@@ -0,0 +1,174 @@
+#ifndef _PDU_CTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_
+#define _PDU_CTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_
+
+#include "pdu_primitive_ctypes.h"
+#include "ros_primitive_types.hpp"
+#include "pdu_primitive_ctypes_conv.hpp"
+#include "pdu_dynamic_memory.hpp"
+/*
+ * Dependent pdu data
+ */
+#include "hako_srv_msgs/pdu_ctype_GetServerStatsResponse.h"
+/*
+ * Dependent ros data
+ */
+#include "hako_srv_msgs/msg/get_server_stats_response.hpp"
+
+/*
+ * Dependent Convertors
+ */
+
+/***************************
+ *
+ * PDU ==> ROS2
+ *
+ ***************************/
+
+static inline int _pdu2ros_GetServerStatsResponse(const char* heap_ptr, Hako_GetServerStatsResponse &src, hako_srv_msgs::msg::GetServerStatsResponse &dst)
+{
+    // string convertor
+    dst.service_name = (const char*)src.service_name;
+    // primitive convert
+    hako_convert_pdu2ros(src.count, dst.count);
+    // primitive convert
+    hako_convert_pdu2ros(src.rejected, dst.rejected);
+    // primitive convert
+    hako_convert_pdu2ros(src.queue_wait_p50_usec, dst.queue_wait_p50_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.queue_wait_p99_usec, dst.queue_wait_p99_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.queue_wait_p999_usec, dst.queue_wait_p999_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.queue_wait_max_usec, dst.queue_wait_max_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.handler_p50_usec, dst.handler_p50_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.handler_p99_usec, dst.handler_p99_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.handler_p999_usec, dst.handler_p999_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.handler_max_usec, dst.handler_max_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.reply_p50_usec, dst.reply_p50_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.reply_p99_usec, dst.reply_p99_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.reply_p999_usec, dst.reply_p999_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.reply_max_usec, dst.reply_max_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.total_p50_usec, dst.total_p50_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.total_p99_usec, dst.total_p99_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.total_p999_usec, dst.total_p999_usec);
+    // primitive convert
+    hako_convert_pdu2ros(src.total_max_usec, dst.total_max_usec);
+    (void)heap_ptr;
+    return 0;
+}
+
+static inline int hako_convert_pdu2ros_GetServerStatsResponse(Hako_GetServerStatsResponse &src, hako_srv_msgs::msg::GetServerStatsResponse &dst)
+{
+    void* base_ptr = (void*)&src;
+    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
+    // Validate magic number and version
+    if (heap_ptr == nullptr) {
+        return -1; // Invalid PDU metadata
+    }
+    else {
+        return _pdu2ros_GetServerStatsResponse((char*)heap_ptr, src, dst);
+    }
+}
+
+/***************************
+ *
+ * ROS2 ==> PDU
+ *
+ ***************************/
+
+static inline bool _ros2pdu_GetServerStatsResponse(hako_srv_msgs::msg::GetServerStatsResponse &src, Hako_GetServerStatsResponse &dst, PduDynamicMemory &dynamic_memory)
+{
+    try {
+        // string convertor
+        (void)hako_convert_ros2pdu_array(
+            src.service_name, src.service_name.length(),
+            dst.service_name, M_ARRAY_SIZE(Hako_GetServerStatsResponse, char, service_name));
+        dst.service_name[src.service_name.length()] = '\0';
+        // primitive convert
+        hako_convert_ros2pdu(src.count, dst.count);
+        // primitive convert
+        hako_convert_ros2pdu(src.rejected, dst.rejected);
+        // primitive convert
+        hako_convert_ros2pdu(src.queue_wait_p50_usec, dst.queue_wait_p50_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.queue_wait_p99_usec, dst.queue_wait_p99_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.queue_wait_p999_usec, dst.queue_wait_p999_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.queue_wait_max_usec, dst.queue_wait_max_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.handler_p50_usec, dst.handler_p50_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.handler_p99_usec, dst.handler_p99_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.handler_p999_usec, dst.handler_p999_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.handler_max_usec, dst.handler_max_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.reply_p50_usec, dst.reply_p50_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.reply_p99_usec, dst.reply_p99_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.reply_p999_usec, dst.reply_p999_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.reply_max_usec, dst.reply_max_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.total_p50_usec, dst.total_p50_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.total_p99_usec, dst.total_p99_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.total_p999_usec, dst.total_p999_usec);
+        // primitive convert
+        hako_convert_ros2pdu(src.total_max_usec, dst.total_max_usec);
+    } catch (const std::runtime_error& e) {
+        std::cerr << "convertor error: " << e.what() << std::endl;
+        return false;
+    }
+    (void)dynamic_memory;
+    return true;
+}
+
+static inline int hako_convert_ros2pdu_GetServerStatsResponse(hako_srv_msgs::msg::GetServerStatsResponse &src, Hako_GetServerStatsResponse** dst)
+{
+    PduDynamicMemory dynamic_memory;
+    Hako_GetServerStatsResponse out;
+    if (!_ros2pdu_GetServerStatsResponse(src, out, dynamic_memory)) {
+        return -1;
+    }
+    int heap_size = dynamic_memory.get_total_size();
+    void* base_ptr = hako_create_empty_pdu(sizeof(Hako_GetServerStatsResponse), heap_size);
+    if (base_ptr == nullptr) {
+        return -1;
+    }
+    // Copy out on base data
+    memcpy(base_ptr, (void*)&out, sizeof(Hako_GetServerStatsResponse));
+
+    // Copy dynamic part and set offsets
+    void* heap_ptr = hako_get_heap_ptr_pdu(base_ptr);
+    dynamic_memory.copy_to_pdu((char*)heap_ptr);
+
+    *dst = (Hako_GetServerStatsResponse*)base_ptr;
+    return hako_get_pdu_meta_data(base_ptr)->total_size;
+}
+
+static inline Hako_GetServerStatsResponse* hako_create_empty_pdu_GetServerStatsResponse(int heap_size)
+{
+    // Allocate PDU memory
+    char* base_ptr = (char*)hako_create_empty_pdu(sizeof(Hako_GetServerStatsResponse), heap_size);
+    if (base_ptr == nullptr) {
+        return nullptr;
+    }
+    return (Hako_GetServerStatsResponse*)base_ptr;
+}
+#endif /* _PDU_CTYPE_CONV_HAKO_hako_srv_msgs_GetServerStatsResponse_HPP_ */
@@ -28,6 +28,8 @@ static inline int _pdu2ros_JoinRequest(const char* heap_ptr, Hako_JoinRequest &s
 {
     // string convertor
     dst.name = (const char*)src.name;
+    // primitive convert
+    hako_convert_pdu2ros(src.session_token, dst.session_token);
     (void)heap_ptr;
     return 0;
 }
@@ -59,6 +61,8 @@ static inline bool _ros2pdu_JoinRequest(hako_srv_msgs::msg::JoinRequest &src, Ha
             src.name, src.name.length(),
             dst.name, M_ARRAY_SIZE(Hako_JoinRequest, char, name));
         dst.name[src.name.length()] = '\0';
+        // primitive convert
+        hako_convert_ros2pdu(src.session_token, dst.session_token);
     } catch (const std::runtime_error& e) {
         std::cerr << "convertor error: " << e.what() << std::endl;
         return false;
@@ -30,6 +30,8 @@ static inline int _pdu2ros_JoinResponse(const char* heap_ptr, Hako_JoinResponse
     hako_convert_pdu2ros(src.status_code, dst.status_code);
     // string convertor
     dst.message = (const char*)src.message;
+    // primitive convert
+    hako_convert_pdu2ros(src.session_token, dst.session_token);
     (void)heap_ptr;
     return 0;
 }
@@ -63,6 +65,8 @@ static inline bool _ros2pdu_JoinResponse(hako_srv_msgs::msg::JoinResponse &src,
             src.message, src.message.length(),
             dst.message, M_ARRAY_SIZE(Hako_JoinResponse, char, message));
         dst.message[src.message.length()] = '\0';
+        // primitive convert
+        hako_convert_ros2pdu(src.session_token, dst.session_token);
     } catch (const std::runtime_error& e) {
         std::cerr << "convertor error: " << e.what() << std::endl;
         return false;
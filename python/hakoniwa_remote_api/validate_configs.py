@@ -65,6 +65,7 @@ class RemoteApiLinter(LinterBase):
         self._check_rpc_service_config_path()
         self._check_servers()
         self._check_time_settings()
+        self._check_server_tuning()
         self._check_participants()
 
     def _check_rpc_service_config_path(self):
@@ -120,6 +121,21 @@ class RemoteApiLinter(LinterBase):
             elif role not in {"conductor", "asset"}:
                 self.errors.append(LintError(f"{ctx}.role: invalid value '{role}'"))
 
+            if "call_timeout_usec" in p:
+                call_timeout = p.get("call_timeout_usec")
+                if self._require_type(call_timeout, int, f"{ctx}.call_timeout_usec") and call_timeout < 0:
+                    self.errors.append(LintError(f"{ctx}.call_timeout_usec: must be >= 0"))
+
+            if "sim_state_cache_usec" in p:
+                cache_usec = p.get("sim_state_cache_usec")
+                if self._require_type(cache_usec, int, f"{ctx}.sim_state_cache_usec") and cache_usec < 0:
+                    self.errors.append(LintError(f"{ctx}.sim_state_cache_usec: must be >= 0"))
+
+            if "reconnect_max_backoff_usec" in p:
+                backoff_usec = p.get("reconnect_max_backoff_usec")
+                if self._require_type(backoff_usec, int, f"{ctx}.reconnect_max_backoff_usec") and backoff_usec < 0:
+                    self.errors.append(LintError(f"{ctx}.reconnect_max_backoff_usec: must be >= 0"))
+
             delta_time = p.get("poll_sleep_time_usec")
             if not self._require_type(delta_time, int, f"{ctx}.poll_sleep_time_usec"):
                 continue
@@ -155,6 +171,37 @@ class RemoteApiLinter(LinterBase):
         if self._require_type(poll_sleep_time, int, "remote-api.poll_sleep_time_usec") and poll_sleep_time <= 0:
             self.errors.append(LintError("remote-api.poll_sleep_time_usec: must be > 0"))
 
+    def _check_server_tuning(self):
+        if "serve_mode" in self.data:
+            serve_mode = self.data.get("serve_mode")
+            if self._require_type(serve_mode, str, "remote-api.serve_mode") and serve_mode not in {"poll", "adaptive"}:
+                self.errors.append(LintError(f"remote-api.serve_mode: invalid value '{serve_mode}'"))
+
+        if "serve_spin_budget_usec" in self.data:
+            spin_budget = self.data.get("serve_spin_budget_usec")
+            if self._require_type(spin_budget, int, "remote-api.serve_spin_budget_usec") and spin_budget < 0:
+                self.errors.append(LintError("remote-api.serve_spin_budget_usec: must be >= 0"))
+
+        if "handler_worker_count" in self.data:
+            workers = self.data.get("handler_worker_count")
+            if self._require_type(workers, int, "remote-api.handler_worker_count") and workers <= 0:
+                self.errors.append(LintError("remote-api.handler_worker_count: must be > 0"))
+
+        if "request_queue_depth" in self.data:
+            depth = self.data.get("request_queue_depth")
+            if self._require_type(depth, int, "remote-api.request_queue_depth") and depth <= 0:
+                self.errors.append(LintError("remote-api.request_queue_depth: must be > 0"))
+
+        if "event_watch_interval_usec" in self.data:
+            interval = self.data.get("event_watch_interval_usec")
+            if self._require_type(interval, int, "remote-api.event_watch_interval_usec") and interval <= 0:
+                self.errors.append(LintError("remote-api.event_watch_interval_usec: must be > 0"))
+
+        if "event_subscription_keepalive_usec" in self.data:
+            keepalive = self.data.get("event_subscription_keepalive_usec")
+            if self._require_type(keepalive, int, "remote-api.event_subscription_keepalive_usec") and keepalive <= 0:
+                self.errors.append(LintError("remote-api.event_subscription_keepalive_usec: must be > 0"))
+
     def _get_server_node_ids(self) -> Optional[Set[str]]:
         servers = self.data.get("servers")
         if not isinstance(servers, list):
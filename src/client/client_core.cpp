@@ -1,32 +1,43 @@
 #include "hakoniwa/api/client_core.hpp"
+#include "hakoniwa/api/logger.hpp"
 #include "hakoniwa/pdu/rpc/rpc_services_client.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_AckEventRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_AckEventResponsePacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_BatchRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_BatchResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetEventRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetEventResponsePacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_GetServerStatsRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_GetServerStatsResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetSimStateRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetSimStateResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_JoinRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_JoinResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_SimControlRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_SimControlResponsePacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_SubscribeEventsRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_SubscribeEventsResponsePacket.hpp"
 
 #include "hakoniwa/pdu/rpc/rpc_service_helper.hpp"
 #include <nlohmann/json.hpp>
 #include <filesystem>
 #include <fstream>
-#include <iostream>
+#include <algorithm>
 #include <chrono>
-#include <thread> // For std::this_thread::sleep_for
+#include <thread>
 
 namespace hakoniwa::api {
 
+// Automatic reconnect: how often the endpoint is checked, and the first backoff.
+static constexpr uint64_t kLinkCheckIntervalUsec = 10000;
+static constexpr uint64_t kReconnectInitialBackoffUsec = 10000;
 
 ClientCore::ClientCore(std::string node_id, std::string config_path)
     : node_id_(std::move(node_id)),
       config_path_(std::move(config_path)) {}
 
 ClientCore::~ClientCore() {
+  stop_io_thread();
   // RpcServiceClient is managed by shared_ptr, so it will be cleaned up
   // automatically.
 }
@@ -69,7 +80,29 @@ bool ClientCore::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> en
             client_name_ = item.value()["name"];
             server_node_id_ = item.value()["server_nodeId"];
             poll_sleep_time_usec_ = item.value()["poll_sleep_time_usec"];
-            std::cout << "Client node ID: " << client_name_ << ", Server node ID: " << server_node_id_ << ", Poll sleep time (usec): " << poll_sleep_time_usec_ << std::endl;
+            if (item.value().contains("call_timeout_usec")) {
+                if (!item.value()["call_timeout_usec"].is_number_unsigned()) {
+                    set_last_error("Config error: 'call_timeout_usec' is not an unsigned number.");
+                    return false;
+                }
+                call_timeout_usec_ = item.value()["call_timeout_usec"].get<uint64_t>();
+            }
+            if (item.value().contains("sim_state_cache_usec")) {
+                if (!item.value()["sim_state_cache_usec"].is_number_unsigned()) {
+                    set_last_error("Config error: 'sim_state_cache_usec' is not an unsigned number.");
+                    return false;
+                }
+                sim_state_cache_usec_ = item.value()["sim_state_cache_usec"].get<uint64_t>();
+            }
+            if (item.value().contains("reconnect_max_backoff_usec")) {
+                if (!item.value()["reconnect_max_backoff_usec"].is_number_unsigned()) {
+                    set_last_error("Config error: 'reconnect_max_backoff_usec' is not an unsigned number.");
+                    return false;
+                }
+                reconnect_max_backoff_usec_ = item.value()["reconnect_max_backoff_usec"].get<uint64_t>();
+            }
+            HAKO_LOG_INFO("Client node ID: " << client_name_ << ", Server node ID: " << server_node_id_
+                          << ", Poll sleep time (usec): " << poll_sleep_time_usec_);
             client_found = true;
             break;
         }
@@ -125,7 +158,7 @@ bool ClientCore::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> en
   }
 
   is_initialized_ = true;
-  std::cout << "Hakoniwa Remote API Client initialized." << std::endl;
+  HAKO_LOG_INFO("Hakoniwa Remote API Client initialized.");
   return true;
 }
 
@@ -134,11 +167,19 @@ bool ClientCore::start() {
         set_last_error("Client is not initialized.");
         return false;
     }
+    if (mux_ != nullptr) {
+        set_last_error("Client is started by its ClientMux.");
+        return false;
+    }
     if (!rpc_client_->start_all_services()) {
         set_last_error("Failed to start RPC client services.");
         return false;
     }
-    std::cout << "Hakoniwa Remote API Client started." << std::endl;
+    reconnect_enabled_ = reconnect_max_backoff_usec_.load() > 0;
+    link_down_ = false;
+    next_link_check_usec_ = 0;
+    start_io_thread();
+    HAKO_LOG_INFO("Hakoniwa Remote API Client started.");
     return true;
 }
 bool ClientCore::is_pdu_end_point_running() {
@@ -149,215 +190,841 @@ bool ClientCore::stop() {
         set_last_error("Client is not initialized.");
         return false;
     }
+    if (mux_ != nullptr) {
+        set_last_error("Client is stopped by its ClientMux.");
+        return false;
+    }
+    stop_io_thread();
     rpc_client_->stop_all_services();
-    std::cout << "Hakoniwa Remote API Client stopped." << std::endl;
+    HAKO_LOG_INFO("Hakoniwa Remote API Client stopped.");
     return true;
 }
-bool ClientCore::wait_response_for(const std::string& expected_service, hakoniwa::pdu::rpc::RpcResponse& out_resp) {
-    std::string service_name_ret;
-    hakoniwa::pdu::rpc::ClientEventType event = hakoniwa::pdu::rpc::ClientEventType::NONE;
-    while (event == hakoniwa::pdu::rpc::ClientEventType::NONE || service_name_ret != expected_service) {
-        event = rpc_client_->poll(service_name_ret, out_resp);
-        if (event == hakoniwa::pdu::rpc::ClientEventType::RESPONSE_TIMEOUT) {
-            set_last_error("Join service call timed out.");
-            return false;
-        } else if (event == hakoniwa::pdu::rpc::ClientEventType::RESPONSE_IN) {
-            if (service_name_ret == expected_service) {
-                //std::cout << "Received response for " << expected_service << " service." << std::endl;
-                break; // Got the response for expected service
-                return true;
-            }
-            else {
-                std::cerr << "Received response for unknown service: " << service_name_ret << std::endl;
-                return false;
-            }
+
+void ClientCore::start_io_thread() {
+    std::lock_guard<std::mutex> lock(submit_mutex_);
+    if (io_running_) {
+        return;
+    }
+    io_running_ = true;
+    io_thread_ = std::thread(&ClientCore::io_loop, this);
+}
+
+void ClientCore::stop_io_thread() {
+    {
+        std::lock_guard<std::mutex> lock(submit_mutex_);
+        io_running_ = false;
+    }
+    submit_cv_.notify_all();
+    arrival_notifier_.notify();
+    if (io_thread_.joinable()) {
+        io_thread_.join();
+    }
+}
+
+bool ClientCore::restart_endpoint() {
+    endpoint_container_->stop_all();
+    if (endpoint_container_->start_all() != HakoPduErrorType::HAKO_PDU_ERR_OK) {
+        HAKO_LOG_WARN("Failed to restart client endpoint: " << endpoint_container_->last_error());
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Automatic reconnect, run by io_step() so that the endpoint is only ever
+ * touched by the I/O thread. Checks the endpoint every kLinkCheckIntervalUsec;
+ * when it is down, fails the calls in flight (their responses are gone with
+ * the connection) and restarts the endpoint, giving each attempt `backoff`
+ * to come up: 10 ms, doubling up to reconnect_max_backoff_usec. Once it is
+ * up, the Join session is resumed with its token, so the server keeps the
+ * asset registration. Returns false while the endpoint is down.
+ */
+bool ClientCore::supervise_link(uint64_t now_usec) {
+    if (!link_down_) {
+        if (now_usec < next_link_check_usec_) {
+            return true;
+        }
+        next_link_check_usec_ = now_usec + kLinkCheckIntervalUsec;
+        if (endpoint_container_->is_running_all()) {
+            return true;
         }
-        std::this_thread::sleep_for(std::chrono::microseconds(100)); // Sleep briefly
+        HAKO_LOG_WARN("Client endpoint of '" << client_name_ << "' is down; reconnecting.");
+        link_down_ = true;
+        endpoint_restarted_ = false;
+        next_restart_usec_ = now_usec;
+        restart_backoff_usec_ = kReconnectInitialBackoffUsec;
+        fail_in_flight_calls("Connection lost.");
+        invalidate_sim_state_cache();
+    }
+    if (now_usec >= next_restart_usec_) {
+        endpoint_restarted_ = restart_endpoint();
+        next_restart_usec_ = now_usec + restart_backoff_usec_;
+        uint64_t max_backoff_usec = std::max(reconnect_max_backoff_usec_.load(), kReconnectInitialBackoffUsec);
+        restart_backoff_usec_ = std::min(restart_backoff_usec_ * 2, max_backoff_usec);
+    }
+    if (!endpoint_restarted_ || !endpoint_container_->is_running_all()) {
+        return false;
     }
+    link_down_ = false;
+    next_link_check_usec_ = now_usec + kLinkCheckIntervalUsec;
+    reconnect_count_++;
+    if (session_token_.load() == 0) {
+        HAKO_LOG_INFO("Client endpoint of '" << client_name_ << "' reconnected.");
+        return true;
+    }
+    // queued like any call; the I/O thread sends it in this round
+    join_async([name = client_name_](const CallStatus& status) {
+        if (status.ok) {
+            HAKO_LOG_INFO("Client '" << name << "' reconnected and resumed its Join session.");
+        } else {
+            HAKO_LOG_ERROR("Client '" << name << "' reconnected, but resuming the Join session failed: "
+                           << status.error);
+        }
+    });
     return true;
 }
 
-bool ClientCore::join() {
-  if (!is_initialized_) {
-    set_last_error("Client is not initialized.");
-    return false;
-  }
-  const std::string service_name = "HakoRemoteApi/Join";
-  HakoRpcServiceServerTemplateType(Join) service_helper;
-  HakoCpp_JoinRequest request_body;
-  HakoCpp_JoinResponse response_body;
-
-  request_body.name = node_id_;
-  if (!service_helper.call(*rpc_client_, service_name, request_body, 0)) {
-    set_last_error("Failed to call Join service (RPC call failed).");
-    return false;
-  }
+void ClientCore::submit(PendingCall call) {
+    std::unique_lock<std::mutex> lock(submit_mutex_);
+    if (!io_running_) {
+        lock.unlock();
+        call.complete(nullptr, "Client is not started.");
+        return;
+    }
+    uint64_t timeout_usec = call_timeout_usec_.load();
+    if (call.hold_usec == kHoldIndefinitely) {
+        timeout_usec = 0;
+    } else if (timeout_usec > 0) {
+        timeout_usec += call.hold_usec;
+    }
+    call.timeout_usec = timeout_usec;
+    call.deadline_usec = (timeout_usec > 0) ? steady_now_usec() + timeout_usec : 0;
+    submitted_.push_back(std::move(call));
+    lock.unlock();
+    submit_cv_.notify_one();
+    io_notifier_->notify(); // the I/O thread may be waiting for a response
+}
 
-  // Poll for response
-  hakoniwa::pdu::rpc::RpcResponse rpc_response;
-  if (!wait_response_for(service_name, rpc_response)) {
-      return false; // Error already set in wait_response_for
-  }
+// Issue the next waiting call of every service that has nothing in flight.
+bool ClientCore::dispatch_waiting_calls() {
+    bool has_in_flight = false;
+    for (size_t i = 0; i < kServiceCount; i++) {
+        while (!in_flight_[i] && !waiting_[i].empty()) {
+            PendingCall call = std::move(waiting_[i].front());
+            waiting_[i].pop_front();
+            if (call.send(*rpc_client_, call.timeout_usec)) {
+                in_flight_[i] = std::move(call);
+            } else {
+                call.complete(nullptr, "Failed to call " + std::string(service_name_of(call.service_id)) +
+                                       " service (RPC call failed).");
+            }
+        }
+        if (in_flight_[i]) {
+            has_in_flight = true;
+        }
+    }
+    return has_in_flight;
+}
 
-  if (!service_helper.get_response_body(rpc_response, response_body)) {
-    set_last_error("Failed to get Join response body.");
-    return false;
-  }
+void ClientCore::complete_in_flight(const std::string& service_name, hakoniwa::pdu::rpc::RpcResponse* response,
+                                    const std::string& error) {
+    ServiceId id = service_id_of(service_name);
+    if (id == ServiceId::Count || !in_flight_[to_index(id)]) {
+        HAKO_LOG_ERROR("Received response for unknown service: " << service_name);
+        return;
+    }
+    if (response != nullptr) {
+        // A response that repeats the request_id of the previous one for this
+        // service (e.g. resent by the transport) must not complete the next call.
+        auto& last = last_request_id_[to_index(id)];
+        if (last && *last == response->header.request_id) {
+            HAKO_LOG_WARN("Discarding duplicate response for " << service_name
+                          << " service, request_id: " << response->header.request_id);
+            return;
+        }
+        if (!response->header.client_name.empty() && response->header.client_name != client_name_) {
+            HAKO_LOG_WARN("Discarding response for " << service_name << " addressed to client '"
+                          << response->header.client_name << "'.");
+            return;
+        }
+        last = response->header.request_id;
+    }
+    PendingCall call = std::move(*in_flight_[to_index(id)]);
+    in_flight_[to_index(id)].reset();
+    if (!call.complete) {
+        HAKO_LOG_DEBUG("Discarding late response for " << service_name << " service.");
+        return;
+    }
+    call.complete(response, error);
+}
 
-  if (response_body.status_code !=
-      hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-    set_last_error("Join service returned an error: " + response_body.message);
-    return false;
-  }
-  return true;
+/*
+ * Fail calls whose deadline has passed and return the time until the next
+ * deadline (0 if none). A timed-out call that was already sent keeps its
+ * service slot until the late response or the RPC layer's timeout arrives,
+ * so that response cannot be taken for the next call's.
+ */
+uint64_t ClientCore::expire_calls(uint64_t now_usec) {
+    uint64_t next_deadline = 0;
+    auto track = [&](uint64_t deadline) {
+        if (deadline != 0 && (next_deadline == 0 || deadline < next_deadline)) {
+            next_deadline = deadline;
+        }
+    };
+    for (size_t i = 0; i < kServiceCount; i++) {
+        const std::string timeout_error = std::string(service_name_of(static_cast<ServiceId>(i))) +
+                                          " service call timed out.";
+        auto& in_flight = in_flight_[i];
+        if (in_flight && in_flight->complete && in_flight->deadline_usec != 0) {
+            if (now_usec >= in_flight->deadline_usec) {
+                in_flight->complete(nullptr, timeout_error);
+                in_flight->complete = nullptr;
+            } else {
+                track(in_flight->deadline_usec);
+            }
+        }
+        auto& waiting = waiting_[i];
+        for (auto it = waiting.begin(); it != waiting.end();) {
+            if (it->deadline_usec != 0 && now_usec >= it->deadline_usec) {
+                it->complete(nullptr, timeout_error);
+                it = waiting.erase(it);
+            } else {
+                track(it->deadline_usec);
+                ++it;
+            }
+        }
+    }
+    return (next_deadline == 0) ? 0 : next_deadline - now_usec;
 }
-bool ClientCore::get_sim_state(HakoSimulationStateInfo &state) {
-    if (!is_initialized_) {
-        set_last_error("Client is not initialized.");
-        return false;
+
+/*
+ * One round of I/O work: take newly submitted calls, expire overdue ones,
+ * send what can be sent and poll once for a response. Runs on the client
+ * I/O thread, or on the ClientMux thread for a multiplexed client.
+ */
+ClientCore::IoStep ClientCore::io_step() {
+    IoStep step;
+    uint64_t now_usec = steady_now_usec();
+    bool link_up = !reconnect_enabled_ || supervise_link(now_usec);
+    step.took_calls = take_submitted_calls();
+    step.until_deadline_usec = expire_calls(now_usec);
+    if (!link_up) {
+        // endpoint down: calls wait (or time out) until it is back
+        return step;
+    }
+    step.has_in_flight = dispatch_waiting_calls();
+    if (!step.has_in_flight) {
+        return step;
     }
-    const std::string service_name = "HakoRemoteApi/GetSimState";
-    HakoRpcServiceServerTemplateType(GetSimState) service_helper;
-    HakoCpp_GetSimStateRequest request_body;
-    HakoCpp_GetSimStateResponse response_body;
 
-    request_body.name = node_id_;
-    if (!service_helper.call(*rpc_client_, service_name, request_body, 0)) {
-        set_last_error("Failed to call GetSimState service (RPC call failed).");
-        return false;
+    std::string service_name;
+    hakoniwa::pdu::rpc::RpcResponse response;
+    auto event = rpc_client_->poll(service_name, response);
+    if (event == hakoniwa::pdu::rpc::ClientEventType::RESPONSE_IN) {
+        HAKO_LOG_DEBUG("Received response for " << service_name << " service.");
+        complete_in_flight(service_name, &response, "");
+        step.responded = true;
+    } else if (event == hakoniwa::pdu::rpc::ClientEventType::RESPONSE_TIMEOUT) {
+        complete_in_flight(service_name, nullptr, service_name + " service call timed out.");
+        step.responded = true;
     }
+    // a completed service may have the next call waiting
+    step.has_in_flight = dispatch_waiting_calls();
+    return step;
+}
 
-    hakoniwa::pdu::rpc::RpcResponse rpc_response;
-    if (!wait_response_for(service_name, rpc_response)) {
-        return false; // Error already set in wait_response_for
+// Move newly submitted calls to their service's FIFO. A call without send
+// (a GetSimState cache hit) is completed right here. I/O thread only.
+bool ClientCore::take_submitted_calls() {
+    {
+        std::lock_guard<std::mutex> lock(submit_mutex_);
+        incoming_.swap(submitted_);
     }
-    
+    bool took_calls = !incoming_.empty();
+    for (auto& call : incoming_) {
+        if (!call.send) {
+            call.complete(nullptr, "");
+            continue;
+        }
+        waiting_[to_index(call.service_id)].push_back(std::move(call));
+    }
+    incoming_.clear();
+    return took_calls;
+}
 
-    if (!service_helper.get_response_body(rpc_response, response_body)) {
-        set_last_error("Failed to get GetSimState response body.");
-        return false;
+// I/O thread only. Frees the service slots too: the responses will not come.
+void ClientCore::fail_in_flight_calls(const std::string& error) {
+    for (auto& in_flight : in_flight_) {
+        if (in_flight) {
+            if (in_flight->complete) {
+                in_flight->complete(nullptr, error);
+            }
+            in_flight.reset();
+        }
     }
+}
 
-    state.sim_state = static_cast<HakoSimulationState>(response_body.sim_state);
-    state.master_time = response_body.master_time;
-    state.is_pdu_created = response_body.is_pdu_created;
-    state.is_simulation_mode = response_body.is_simulation_mode;
-    state.is_pdu_sync_mode = response_body.is_pdu_sync_mode;
-    return true;
+// Fail everything that has not completed. The I/O thread must not be running.
+void ClientCore::fail_pending_calls(const std::string& error) {
+    {
+        std::lock_guard<std::mutex> lock(submit_mutex_);
+        incoming_.swap(submitted_);
+    }
+    for (auto& call : incoming_) {
+        call.complete(nullptr, error);
+    }
+    incoming_.clear();
+    fail_in_flight_calls(error);
+    for (size_t i = 0; i < kServiceCount; i++) {
+        for (auto& call : waiting_[i]) {
+            call.complete(nullptr, error);
+        }
+        waiting_[i].clear();
+    }
 }
 
-bool ClientCore::sim_control(HakoSimulationControlCommand command) {
+/*
+ * The only thread that touches rpc_client_ and, for automatic reconnect, the
+ * endpoint. Each service has at most one
+ * request in flight; further calls to the same service wait in FIFO order.
+ * While a response is outstanding and nothing has arrived, the thread sleeps
+ * 1, 2, 4, ... usec up to kResponsePollMaxBackoffUsec; a new call cuts the
+ * sleep short. The RPC client has no receive callback, so this backoff is
+ * the only way a response is noticed, and its small fixed cap bounds how
+ * late one is picked up, even after a long wait such as a long-poll GetEvent.
+ */
+void ClientCore::io_loop() {
+    bool has_in_flight = false;
+    uint64_t backoff_usec = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(submit_mutex_);
+            auto woken = [&] { return !io_running_ || !submitted_.empty(); };
+            if (!has_in_flight && reconnect_enabled_) {
+                // wake up for the next link check even when idle
+                submit_cv_.wait_for(lock, std::chrono::microseconds(kLinkCheckIntervalUsec), woken);
+            } else if (!has_in_flight) {
+                submit_cv_.wait(lock, woken);
+            }
+            if (!io_running_) {
+                break;
+            }
+        }
+        IoStep step = io_step();
+        has_in_flight = step.has_in_flight;
+        if (step.took_calls || step.responded) {
+            backoff_usec = 0;
+        }
+        if (!has_in_flight || step.responded) {
+            continue;
+        }
+        backoff_usec = (backoff_usec == 0) ? 1 : std::min(backoff_usec * 2, kResponsePollMaxBackoffUsec);
+        uint64_t wait_usec = backoff_usec;
+        if (step.until_deadline_usec != 0 && step.until_deadline_usec < wait_usec) {
+            wait_usec = step.until_deadline_usec;
+        }
+        if (reconnect_enabled_) {
+            wait_usec = std::min(wait_usec, kLinkCheckIntervalUsec);
+        }
+        arrival_notifier_.wait_for(wait_usec);
+    }
+    fail_pending_calls("Client stopped.");
+}
 
+/*
+ * Queue a call of one service. `decode` turns the RPC response into the
+ * result and sets result.error when the server reported a failure.
+ */
+template <typename ServiceHelper, typename Result, typename Request, typename Decode>
+void ClientCore::call_async(ServiceId service_id, Request request_body, Decode decode, Completion<Result> done,
+                            uint64_t hold_usec) {
+    auto service_helper = std::make_shared<ServiceHelper>();
+    PendingCall call;
+    call.service_id = service_id;
+    call.hold_usec = hold_usec;
+    call.send = [service_helper, service_id, request_body = std::move(request_body)](
+                    hakoniwa::pdu::rpc::RpcServicesClient& rpc_client, uint64_t timeout_usec) mutable {
+        return service_helper->call(rpc_client, std::string(service_name_of(service_id)), request_body,
+                                    timeout_usec);
+    };
+    call.complete = [service_helper, decode = std::move(decode), done = std::move(done)](
+                        hakoniwa::pdu::rpc::RpcResponse* response, const std::string& error) {
+        Result result;
+        if (response == nullptr) {
+            result.error = error;
+        } else {
+            decode(*service_helper, *response, result);
+        }
+        result.ok = result.error.empty();
+        if (done) {
+            done(result);
+        }
+    };
+    submit(std::move(call));
+}
+
+template <typename Result, typename Start>
+static std::future<Result> make_future(Start start) {
+    auto promise = std::make_shared<std::promise<Result>>();
+    std::future<Result> future = promise->get_future();
+    start([promise](const Result& result) { promise->set_value(result); });
+    return future;
+}
+
+bool ClientCore::finish(const CallStatus& status) {
+    if (!status.ok) {
+        set_last_error(status.error);
+    }
+    return status.ok;
+}
+
+void ClientCore::join_async(Completion<CallStatus> done) {
+    HakoCpp_JoinRequest request_body;
+    request_body.name = node_id_;
+    request_body.session_token = session_token_.load();
+    call_async<HakoRpcServiceServerTemplateType(Join), CallStatus>(
+        ServiceId::Join, std::move(request_body),
+        [this](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response, CallStatus& result) {
+            HakoCpp_JoinResponse response_body;
+            if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get Join response body.";
+            } else if (response_body.status_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "Join service returned an error: " + response_body.message;
+            } else {
+                session_token_ = response_body.session_token;
+            }
+        },
+        std::move(done));
+}
+std::future<CallStatus> ClientCore::join_async() {
+    return make_future<CallStatus>([this](Completion<CallStatus> done) { join_async(std::move(done)); });
+}
+bool ClientCore::join() {
     if (!is_initialized_) {
         set_last_error("Client is not initialized.");
         return false;
     }
-    const std::string service_name = "HakoRemoteApi/SimControl";
-    HakoRpcServiceServerTemplateType(SimControl) service_helper;
-    HakoCpp_SimControlRequest request_body;
-    request_body.name = node_id_;
-    request_body.op = static_cast<Hako_int32>(command);
-    HakoCpp_SimControlResponse response_body;
+    return finish(join_async().get());
+}
 
-    if (!service_helper.call(*rpc_client_, service_name, request_body, 0)) {
-        set_last_error("Failed to call SimControl service (RPC call failed).");
+bool ClientCore::cached_sim_state(HakoSimulationStateInfo& state) {
+    uint64_t max_age_usec = sim_state_cache_usec_.load();
+    if (max_age_usec == 0) {
         return false;
     }
-
-    hakoniwa::pdu::rpc::RpcResponse rpc_response;
-    if (!wait_response_for(service_name, rpc_response)) {
-        return false; // Error already set in wait_response_for
-    }
-    
-    if (!service_helper.get_response_body(rpc_response, response_body)) {
-        set_last_error("Failed to get SimControl response body.");
+    std::lock_guard<std::mutex> lock(sim_state_cache_mutex_);
+    if (!sim_state_cache_.valid) {
         return false;
     }
-
-    if (response_body.status_code !=
-        hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-        set_last_error("SimControl service returned an error: " + response_body.message);
+    uint64_t age_usec = steady_now_usec() - sim_state_cache_.received_usec;
+    if (age_usec > max_age_usec) {
         return false;
     }
+    state = sim_state_cache_.state;
+    if (state.sim_state == HakoSimulationState::HakoSim_Running) {
+        state.master_time += static_cast<int64_t>(age_usec);
+    }
     return true;
 }
 
-bool ClientCore::get_event(HakoSimulationAssetEvent &event_code) {
+uint64_t ClientCore::sim_state_cache_epoch() {
+    std::lock_guard<std::mutex> lock(sim_state_cache_mutex_);
+    return sim_state_cache_.epoch;
+}
+
+// epoch: sim_state_cache_epoch() when the request was sent. A state sampled
+// before an invalidation must not repopulate the cache after it.
+void ClientCore::store_sim_state(const HakoSimulationStateInfo& state, uint64_t epoch) {
+    if (sim_state_cache_usec_.load() == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(sim_state_cache_mutex_);
+    if (sim_state_cache_.epoch != epoch) {
+        return;
+    }
+    sim_state_cache_.valid = true;
+    sim_state_cache_.state = state;
+    sim_state_cache_.received_usec = steady_now_usec();
+}
+
+void ClientCore::invalidate_sim_state_cache() {
+    std::lock_guard<std::mutex> lock(sim_state_cache_mutex_);
+    sim_state_cache_.valid = false;
+    sim_state_cache_.epoch++;
+}
+
+void ClientCore::get_sim_state_async(Completion<CallResult<HakoSimulationStateInfo>> done) {
+    CallResult<HakoSimulationStateInfo> cached;
+    if (cached_sim_state(cached.value)) {
+        // no round trip, but the callback runs on the I/O thread like every
+        // other completion; get_sim_state() serves hits inline instead
+        cached.ok = true;
+        PendingCall call;
+        call.service_id = ServiceId::GetSimState;
+        call.complete = [cached, done = std::move(done)](hakoniwa::pdu::rpc::RpcResponse*,
+                                                          const std::string& error) {
+            CallResult<HakoSimulationStateInfo> result = cached;
+            if (!error.empty()) {
+                result.ok = false;
+                result.error = error;
+            }
+            if (done) {
+                done(result);
+            }
+        };
+        submit(std::move(call));
+        return;
+    }
+    HakoCpp_GetSimStateRequest request_body;
+    request_body.name = node_id_;
+    uint64_t epoch = sim_state_cache_epoch();
+    call_async<HakoRpcServiceServerTemplateType(GetSimState), CallResult<HakoSimulationStateInfo>>(
+        ServiceId::GetSimState, std::move(request_body),
+        [this, epoch](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response,
+           CallResult<HakoSimulationStateInfo>& result) {
+            HakoCpp_GetSimStateResponse response_body;
+            if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "GetSimState service returned an error result code in RPC header: " +
+                               std::to_string(rpc_response.header.result_code);
+            } else if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get GetSimState response body.";
+            } else {
+                result.value.sim_state = static_cast<HakoSimulationState>(response_body.sim_state);
+                result.value.master_time = response_body.master_time;
+                result.value.is_pdu_created = response_body.is_pdu_created;
+                result.value.is_simulation_mode = response_body.is_simulation_mode;
+                result.value.is_pdu_sync_mode = response_body.is_pdu_sync_mode;
+                store_sim_state(result.value, epoch);
+            }
+        },
+        std::move(done));
+}
+std::future<CallResult<HakoSimulationStateInfo>> ClientCore::get_sim_state_async() {
+    return make_future<CallResult<HakoSimulationStateInfo>>(
+        [this](Completion<CallResult<HakoSimulationStateInfo>> done) { get_sim_state_async(std::move(done)); });
+}
+bool ClientCore::get_sim_state(HakoSimulationStateInfo &state) {
     if (!is_initialized_) {
         set_last_error("Client is not initialized.");
         return false;
     }
-    const std::string service_name = "HakoRemoteApi/GetEvent";
-    HakoRpcServiceServerTemplateType(GetEvent) service_helper;
-    HakoCpp_GetEventRequest request_body;
-    HakoCpp_GetEventResponse response_body;
-
-    request_body.name = node_id_;
-    if (!service_helper.call(*rpc_client_, service_name, request_body, 0)) {
-        #ifdef ENABLE_DEBUG_MESSAGES
-        std::cerr << "DEBUG: service_helper.call failed in get_event()" << std::endl;
-        #endif
-        set_last_error("Failed to call GetEvent service (RPC call failed).");
+    // A cache hit needs no round trip, so it is not handed to the I/O thread.
+    if (cached_sim_state(state)) {
+        return true;
+    }
+    auto result = get_sim_state_async().get();
+    if (!finish(result)) {
         return false;
     }
+    state = result.value;
+    return true;
+}
 
-    hakoniwa::pdu::rpc::RpcResponse rpc_response;
-    if (!wait_response_for(service_name, rpc_response)) {
-        #ifdef ENABLE_DEBUG_MESSAGES
-        std::cerr << "DEBUG: wait_response_for failed in get_event()" << std::endl;
-        #endif
-        return false; // Error already set in wait_response_for
+void ClientCore::get_server_stats_async(const std::string &target_service, Completion<CallResult<ServiceStats>> done) {
+    HakoCpp_GetServerStatsRequest request_body;
+    request_body.name = node_id_;
+    request_body.service_name = target_service;
+    call_async<HakoRpcServiceServerTemplateType(GetServerStats), CallResult<ServiceStats>>(
+        ServiceId::GetServerStats, std::move(request_body),
+        [](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response, CallResult<ServiceStats>& result) {
+            HakoCpp_GetServerStatsResponse response_body;
+            if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "GetServerStats service returned an error result code in RPC header: " +
+                               std::to_string(rpc_response.header.result_code);
+                return;
+            }
+            if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get GetServerStats response body.";
+                return;
+            }
+            ServiceStats& stats = result.value;
+            stats.service_name = response_body.service_name;
+            stats.rejected = response_body.rejected;
+            stats.queue_wait = {response_body.count, response_body.queue_wait_p50_usec, response_body.queue_wait_p99_usec,
+                                response_body.queue_wait_p999_usec, response_body.queue_wait_max_usec};
+            stats.handler = {response_body.count, response_body.handler_p50_usec, response_body.handler_p99_usec,
+                             response_body.handler_p999_usec, response_body.handler_max_usec};
+            stats.reply = {response_body.count, response_body.reply_p50_usec, response_body.reply_p99_usec,
+                           response_body.reply_p999_usec, response_body.reply_max_usec};
+            stats.total = {response_body.count, response_body.total_p50_usec, response_body.total_p99_usec,
+                           response_body.total_p999_usec, response_body.total_max_usec};
+        },
+        std::move(done));
+}
+std::future<CallResult<ServiceStats>> ClientCore::get_server_stats_async(const std::string &target_service) {
+    return make_future<CallResult<ServiceStats>>([this, &target_service](Completion<CallResult<ServiceStats>> done) {
+        get_server_stats_async(target_service, std::move(done));
+    });
+}
+bool ClientCore::get_server_stats(const std::string &target_service, ServiceStats &stats) {
+    if (!is_initialized_) {
+        set_last_error("Client is not initialized.");
+        return false;
     }
-
-    if (!service_helper.get_response_body(rpc_response, response_body)) {
-        #ifdef ENABLE_DEBUG_MESSAGES
-        std::cerr << "DEBUG: get_response_body failed in get_event()" << std::endl;
-        #endif
-        set_last_error("Failed to get GetEvent response body.");
+    auto result = get_server_stats_async(target_service).get();
+    if (!finish(result)) {
         return false;
     }
-    event_code = static_cast<HakoSimulationAssetEvent>(response_body.event_code);
-
+    stats = std::move(result.value);
     return true;
 }
 
+void ClientCore::sim_control_async(HakoSimulationControlCommand command, Completion<CallStatus> done) {
+    HakoCpp_SimControlRequest request_body;
+    request_body.name = node_id_;
+    request_body.op = static_cast<Hako_int32>(command);
+    invalidate_sim_state_cache();
+    call_async<HakoRpcServiceServerTemplateType(SimControl), CallStatus>(
+        ServiceId::SimControl, std::move(request_body),
+        [this](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response, CallStatus& result) {
+            // a state read while the command was in flight may predate it
+            invalidate_sim_state_cache();
+            HakoCpp_SimControlResponse response_body;
+            if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get SimControl response body.";
+            } else if (response_body.status_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "SimControl service returned an error: " + response_body.message;
+            }
+        },
+        std::move(done));
+}
+std::future<CallStatus> ClientCore::sim_control_async(HakoSimulationControlCommand command) {
+    return make_future<CallStatus>(
+        [this, command](Completion<CallStatus> done) { sim_control_async(command, std::move(done)); });
+}
+bool ClientCore::sim_control(HakoSimulationControlCommand command) {
+    if (!is_initialized_) {
+        set_last_error("Client is not initialized.");
+        return false;
+    }
+    return finish(sim_control_async(command).get());
+}
 
-bool ClientCore::ack_event(HakoSimulationAssetEvent event_code) {
+void ClientCore::get_event_async(Completion<CallResult<HakoSimulationAssetEvent>> done) {
+    get_event_async(0, std::move(done));
+}
+void ClientCore::get_event_async(uint32_t wait_timeout_msec, Completion<CallResult<HakoSimulationAssetEvent>> done) {
+    HakoCpp_GetEventRequest request_body;
+    request_body.name = node_id_;
+    request_body.wait_timeout_msec = wait_timeout_msec;
+    call_async<HakoRpcServiceServerTemplateType(GetEvent), CallResult<HakoSimulationAssetEvent>>(
+        ServiceId::GetEvent, std::move(request_body),
+        [this](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response,
+           CallResult<HakoSimulationAssetEvent>& result) {
+            HakoCpp_GetEventResponse response_body;
+            if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "GetEvent service returned an error result code in RPC header: " +
+                               std::to_string(rpc_response.header.result_code);
+            } else if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get GetEvent response body.";
+            } else {
+                result.value = static_cast<HakoSimulationAssetEvent>(response_body.event_code);
+                if (result.value != HakoSimulationAssetEvent::HakoSimAssetEvent_None) {
+                    invalidate_sim_state_cache();
+                }
+            }
+        },
+        std::move(done), uint64_t{wait_timeout_msec} * 1000);
+}
+std::future<CallResult<HakoSimulationAssetEvent>> ClientCore::get_event_async(uint32_t wait_timeout_msec) {
+    return make_future<CallResult<HakoSimulationAssetEvent>>(
+        [this, wait_timeout_msec](Completion<CallResult<HakoSimulationAssetEvent>> done) {
+            get_event_async(wait_timeout_msec, std::move(done));
+        });
+}
+bool ClientCore::get_event(HakoSimulationAssetEvent &event_code) {
+    return get_event(event_code, 0);
+}
+bool ClientCore::get_event(HakoSimulationAssetEvent &event_code, uint32_t wait_timeout_msec) {
     if (!is_initialized_) {
         set_last_error("Client is not initialized.");
         return false;
     }
-    const std::string service_name = "HakoRemoteApi/AckEvent";
-    HakoRpcServiceServerTemplateType(AckEvent) service_helper;
+    auto result = get_event_async(wait_timeout_msec).get();
+    if (!finish(result)) {
+        return false;
+    }
+    event_code = result.value;
+    return true;
+}
+
+void ClientCore::ack_event_async(HakoSimulationAssetEvent event_code, Completion<CallStatus> done) {
     HakoCpp_AckEventRequest request_body;
     request_body.name = node_id_;
     request_body.event_code = static_cast<Hako_uint32>(event_code);
     request_body.result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK; // Assuming success for now
-    HakoCpp_AckEventResponse response_body;
-
-    if (!service_helper.call(*rpc_client_, service_name, request_body, 0)) {
-        set_last_error("Failed to call AckEvent service (RPC call failed).");
+    invalidate_sim_state_cache();
+    call_async<HakoRpcServiceServerTemplateType(AckEvent), CallStatus>(
+        ServiceId::AckEvent, std::move(request_body),
+        [this](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response, CallStatus& result) {
+            invalidate_sim_state_cache();
+            HakoCpp_AckEventResponse response_body;
+            if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get AckEvent response body.";
+            } else if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "AckEvent service returned an error result code in RPC header.";
+            }
+        },
+        std::move(done));
+}
+std::future<CallStatus> ClientCore::ack_event_async(HakoSimulationAssetEvent event_code) {
+    return make_future<CallStatus>(
+        [this, event_code](Completion<CallStatus> done) { ack_event_async(event_code, std::move(done)); });
+}
+bool ClientCore::ack_event(HakoSimulationAssetEvent event_code) {
+    if (!is_initialized_) {
+        set_last_error("Client is not initialized.");
         return false;
     }
+    return finish(ack_event_async(event_code).get());
+}
 
-    hakoniwa::pdu::rpc::RpcResponse rpc_response;
-    if (!wait_response_for(service_name, rpc_response)) {
-        return false; // Error already set in wait_response_for
+void ClientCore::subscribe_events(Completion<CallResult<HakoSimulationAssetEvent>> on_event) {
+    uint64_t generation = ++subscription_generation_;
+    arm_event_subscription(generation,
+                           std::make_shared<Completion<CallResult<HakoSimulationAssetEvent>>>(std::move(on_event)));
+}
+
+void ClientCore::unsubscribe_events() {
+    ++subscription_generation_;
+}
+
+void ClientCore::arm_event_subscription(uint64_t generation,
+                                        std::shared_ptr<Completion<CallResult<HakoSimulationAssetEvent>>> on_event) {
+    HakoCpp_SubscribeEventsRequest request_body;
+    request_body.name = node_id_;
+    call_async<HakoRpcServiceServerTemplateType(SubscribeEvents), CallResult<HakoSimulationAssetEvent>>(
+        ServiceId::SubscribeEvents, std::move(request_body),
+        [this](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response,
+           CallResult<HakoSimulationAssetEvent>& result) {
+            HakoCpp_SubscribeEventsResponse response_body;
+            if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "SubscribeEvents service returned an error result code in RPC header: " +
+                               std::to_string(rpc_response.header.result_code);
+            } else if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get SubscribeEvents response body.";
+            } else {
+                result.value = static_cast<HakoSimulationAssetEvent>(response_body.event_code);
+                if (result.value != HakoSimulationAssetEvent::HakoSimAssetEvent_None) {
+                    invalidate_sim_state_cache();
+                }
+            }
+        },
+        [this, generation, on_event](const CallResult<HakoSimulationAssetEvent>& result) {
+            if (subscription_generation_.load() != generation) {
+                return; // unsubscribed or replaced
+            }
+            if (!result.ok || result.value != HakoSimulationAssetEvent::HakoSimAssetEvent_None) {
+                if (*on_event) {
+                    (*on_event)(result);
+                }
+            }
+            // None is the server's keepalive: just re-arm
+            if (result.ok && subscription_generation_.load() == generation) {
+                arm_event_subscription(generation, on_event);
+            }
+        },
+        kHoldIndefinitely);
+}
+
+BatchBuilder ClientCore::batch() {
+    return BatchBuilder(*this);
+}
+
+void ClientCore::batch_async(std::vector<BatchOp> ops, Completion<CallResult<BatchReply>> done) {
+    HakoCpp_BatchRequest request_body{};
+    request_body.name = node_id_;
+    if (ops.empty() || ops.size() > request_body.ops.size()) {
+        CallResult<BatchReply> result;
+        result.error = "Batch must hold between 1 and " + std::to_string(request_body.ops.size()) +
+                       " operations, got " + std::to_string(ops.size()) + ".";
+        if (done) {
+            done(result);
+        }
+        return;
+    }
+    request_body.op_count = static_cast<Hako_uint32>(ops.size());
+    bool changes_state = false;
+    for (size_t i = 0; i < ops.size(); i++) {
+        request_body.ops[i] = static_cast<Hako_uint32>(ops[i].op);
+        request_body.args[i] = ops[i].arg;
+        changes_state |= (ops[i].op == ServiceId::SimControl || ops[i].op == ServiceId::AckEvent);
     }
+    if (changes_state) {
+        invalidate_sim_state_cache();
+    }
+    uint64_t epoch = sim_state_cache_epoch();
+    call_async<HakoRpcServiceServerTemplateType(Batch), CallResult<BatchReply>>(
+        ServiceId::Batch, std::move(request_body),
+        [this, epoch, changes_state, ops = std::move(ops)](auto& service_helper, hakoniwa::pdu::rpc::RpcResponse& rpc_response,
+                               CallResult<BatchReply>& result) {
+            HakoCpp_BatchResponse response_body;
+            if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                result.error = "Batch service returned an error result code in RPC header: " +
+                               std::to_string(rpc_response.header.result_code);
+                return;
+            }
+            if (!service_helper.get_response_body(rpc_response, response_body)) {
+                result.error = "Failed to get Batch response body.";
+                return;
+            }
+            if (response_body.op_count != ops.size()) {
+                result.error = "Batch response carries " + std::to_string(response_body.op_count) +
+                               " results for " + std::to_string(ops.size()) + " operations.";
+                return;
+            }
+            BatchReply& reply = result.value;
+            reply.results.reserve(ops.size());
+            for (size_t i = 0; i < ops.size(); i++) {
+                reply.results.push_back({ops[i].op, response_body.result_codes[i], response_body.values[i]});
+                if (ops[i].op == ServiceId::GetSimState &&
+                    response_body.result_codes[i] == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+                    HakoSimulationStateInfo state;
+                    state.sim_state = static_cast<HakoSimulationState>(response_body.values[i]);
+                    state.master_time = response_body.master_time;
+                    state.is_pdu_created = response_body.is_pdu_created;
+                    state.is_simulation_mode = response_body.is_simulation_mode;
+                    state.is_pdu_sync_mode = response_body.is_pdu_sync_mode;
+                    reply.sim_state = state;
+                }
+            }
+            bool got_event = std::any_of(reply.results.begin(), reply.results.end(), [](const BatchOpResult& r) {
+                return r.op == ServiceId::GetEvent &&
+                       r.value != static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None);
+            });
+            if (got_event || changes_state) {
+                invalidate_sim_state_cache();
+            } else if (reply.sim_state) {
+                // the state may be sampled before a SimControl of the same batch,
+                // so only cache it when nothing in the batch changes the state
+                store_sim_state(*reply.sim_state, epoch);
+            }
+        },
+        std::move(done));
+}
 
-    if (!service_helper.get_response_body(rpc_response, response_body)) {
-        set_last_error("Failed to get AckEvent response body.");
+void BatchBuilder::send_async(Completion<CallResult<BatchReply>> done) {
+    client_->batch_async(ops_, std::move(done));
+}
+std::future<CallResult<BatchReply>> BatchBuilder::send_async() {
+    return make_future<CallResult<BatchReply>>(
+        [this](Completion<CallResult<BatchReply>> done) { send_async(std::move(done)); });
+}
+bool BatchBuilder::send(BatchReply &reply) {
+    if (!client_->is_initialized_) {
+        client_->set_last_error("Client is not initialized.");
         return false;
     }
-    if (rpc_response.header.result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-        set_last_error("AckEvent service returned an error result code in RPC header.");
+    auto result = send_async().get();
+    if (!client_->finish(result)) {
         return false;
     }
+    reply = std::move(result.value);
     return true;
 }
 
 void ClientCore::set_last_error(const std::string &msg) {
-  std::cerr << "ERROR: " << msg << std::endl;
+  HAKO_LOG_ERROR(msg);
   last_error_ = msg;
 }
 std::string ClientCore::last_error() const { return last_error_; }
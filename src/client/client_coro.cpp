@@ -0,0 +1,89 @@
+#include "hakoniwa/api/client_coro.hpp"
+
+#include <chrono>
+
+namespace hakoniwa::api {
+
+// Fire-and-forget root coroutine that owns a spawned task.
+struct ClientExecutor::Detached {
+    struct promise_type {
+        Detached get_return_object() noexcept {
+            return Detached{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+    std::coroutine_handle<promise_type> handle;
+};
+
+ClientExecutor::Detached ClientExecutor::run_detached(ClientExecutor& executor, Task<void> task) {
+    co_await task;
+    executor.task_finished();
+}
+
+void ClientExecutor::post(std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        ready_.push_back(handle);
+    }
+    cv_.notify_one();
+}
+
+void ClientExecutor::spawn(Task<void> task) {
+    live_tasks_++;
+    post(run_detached(*this, std::move(task)).handle);
+}
+
+void ClientExecutor::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_requested_ = true;
+    }
+    cv_.notify_one();
+}
+
+void ClientExecutor::add_timer(uint64_t deadline_usec, std::coroutine_handle<> handle) {
+    timers_.push(Timer{deadline_usec, handle});
+}
+
+void ClientExecutor::run() {
+    std::vector<std::coroutine_handle<>> batch;
+    for (;;) {
+        uint64_t now = steady_now_usec();
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            if (stop_requested_) {
+                stop_requested_ = false;
+                return;
+            }
+            // Only after the stop check: a due timer taken here is resumed in
+            // this round, one left in timers_ is resumed by a later run().
+            while (!timers_.empty() && timers_.top().deadline_usec <= now) {
+                batch.push_back(timers_.top().handle);
+                timers_.pop();
+            }
+            batch.insert(batch.end(), ready_.begin(), ready_.end());
+            ready_.clear();
+            if (batch.empty()) {
+                if (live_tasks_ == 0) {
+                    return;
+                }
+                auto wakeup = [this] { return stop_requested_ || !ready_.empty(); };
+                if (timers_.empty()) {
+                    cv_.wait(lock, wakeup);
+                } else {
+                    cv_.wait_for(lock, std::chrono::microseconds(timers_.top().deadline_usec - now), wakeup);
+                }
+                continue;
+            }
+        }
+        for (auto handle : batch) {
+            handle.resume();
+        }
+        batch.clear();
+    }
+}
+
+} // namespace hakoniwa::api
@@ -0,0 +1,169 @@
+#include "hakoniwa/api/client_mux.hpp"
+#include "hakoniwa/api/logger.hpp"
+
+#include <algorithm>
+
+namespace hakoniwa::api {
+
+namespace {
+// Idle wait when no client has a response outstanding; submit() and stop()
+// wake the thread earlier.
+constexpr uint64_t kIdleWaitUsec = 1000000;
+}
+
+ClientMux::ClientMux(std::string config_path) : config_path_(std::move(config_path)) {}
+
+ClientMux::~ClientMux() {
+    if (is_started_) {
+        stop();
+    }
+}
+
+ClientCore* ClientMux::add_client(const std::string& node_id) {
+    if (is_initialized_) {
+        last_error_ = "Clients must be added before initialize().";
+        return nullptr;
+    }
+    if (by_name_.count(node_id) != 0) {
+        last_error_ = "Client nodeId '" + node_id + "' is already added.";
+        return nullptr;
+    }
+    auto client = std::make_unique<ClientCore>(node_id, config_path_);
+    client->mux_ = this;
+    client->io_notifier_ = &notifier_;
+    ClientCore* raw = client.get();
+    by_name_[node_id] = raw;
+    clients_.push_back(std::move(client));
+    return raw;
+}
+
+bool ClientMux::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container) {
+    if (is_initialized_) {
+        last_error_ = "ClientMux is already initialized.";
+        return false;
+    }
+    if (clients_.empty()) {
+        last_error_ = "ClientMux has no clients.";
+        return false;
+    }
+    endpoint_container_ = endpoint_container;
+    for (auto& client : clients_) {
+        if (!client->initialize(endpoint_container_)) {
+            last_error_ = "Client '" + client->node_id() + "': " + client->last_error();
+            return false;
+        }
+        if (client->client_name() != client->node_id()) {
+            auto [it, inserted] = by_name_.emplace(client->client_name(), client.get());
+            if (!inserted && it->second != client.get()) {
+                last_error_ = "Client name '" + client->client_name() + "' is used by more than one client.";
+                return false;
+            }
+        }
+    }
+    is_initialized_ = true;
+    HAKO_LOG_INFO("Hakoniwa Remote API ClientMux initialized with " << clients_.size() << " clients.");
+    return true;
+}
+
+void ClientMux::set_io_running(bool running) {
+    for (auto& client : clients_) {
+        {
+            std::lock_guard<std::mutex> lock(client->submit_mutex_);
+            client->io_running_ = running;
+        }
+    }
+}
+
+bool ClientMux::start() {
+    if (!is_initialized_) {
+        last_error_ = "ClientMux is not initialized.";
+        return false;
+    }
+    if (is_started_) {
+        return true;
+    }
+    for (size_t i = 0; i < clients_.size(); i++) {
+        if (!clients_[i]->rpc_client_->start_all_services()) {
+            last_error_ = "Failed to start RPC client services of '" + clients_[i]->node_id() + "'.";
+            for (size_t j = 0; j < i; j++) {
+                clients_[j]->rpc_client_->stop_all_services();
+            }
+            return false;
+        }
+    }
+    set_io_running(true);
+    running_ = true;
+    io_thread_ = std::thread(&ClientMux::io_loop, this);
+    is_started_ = true;
+    HAKO_LOG_INFO("Hakoniwa Remote API ClientMux started.");
+    return true;
+}
+
+bool ClientMux::stop() {
+    if (!is_started_) {
+        last_error_ = "ClientMux is not started.";
+        return false;
+    }
+    set_io_running(false);
+    running_ = false;
+    notifier_.notify();
+    if (io_thread_.joinable()) {
+        io_thread_.join();
+    }
+    for (auto& client : clients_) {
+        client->fail_pending_calls("Client stopped.");
+        client->rpc_client_->stop_all_services();
+    }
+    is_started_ = false;
+    HAKO_LOG_INFO("Hakoniwa Remote API ClientMux stopped.");
+    return true;
+}
+
+ClientCore* ClientMux::client(const std::string& name) const {
+    auto it = by_name_.find(name);
+    return (it == by_name_.end()) ? nullptr : it->second;
+}
+
+/*
+ * ClientCore::io_loop() for all clients at once: one io_step() per client
+ * per round, then a single backoff wait (1, 2, 4, ... usec up to
+ * ClientCore::kResponsePollMaxBackoffUsec) when responses are outstanding
+ * but none arrived. Any client's submit() ends the wait.
+ */
+void ClientMux::io_loop() {
+    uint64_t backoff_usec = 0;
+    while (running_) {
+        bool took_calls = false;
+        bool responded = false;
+        bool has_in_flight = false;
+        uint64_t until_deadline_usec = 0;
+        for (auto& client : clients_) {
+            ClientCore::IoStep step = client->io_step();
+            took_calls |= step.took_calls;
+            responded |= step.responded;
+            has_in_flight |= step.has_in_flight;
+            if (step.until_deadline_usec != 0 &&
+                (until_deadline_usec == 0 || step.until_deadline_usec < until_deadline_usec)) {
+                until_deadline_usec = step.until_deadline_usec;
+            }
+        }
+        if (took_calls || responded) {
+            backoff_usec = 0;
+        }
+        if (!has_in_flight) {
+            notifier_.wait_for(kIdleWaitUsec);
+            continue;
+        }
+        if (responded) {
+            continue;
+        }
+        backoff_usec = (backoff_usec == 0) ? 1 : std::min(backoff_usec * 2, ClientCore::kResponsePollMaxBackoffUsec);
+        uint64_t wait_usec = backoff_usec;
+        if (until_deadline_usec != 0 && until_deadline_usec < wait_usec) {
+            wait_usec = until_deadline_usec;
+        }
+        notifier_.wait_for(wait_usec);
+    }
+}
+
+} // namespace hakoniwa::api
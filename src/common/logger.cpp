@@ -0,0 +1,158 @@
+#include "hakoniwa/api/logger.hpp"
+#include "hakoniwa/api/ring_buffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace hakoniwa::api {
+
+namespace {
+constexpr size_t kLogRingCapacity = 4096;
+// records are batched for up to this long after the first one arrives
+constexpr uint64_t kLogWriterIntervalUsec = 10000;
+// how often a batching writer checks for an urgent record
+constexpr uint64_t kLogUrgentCheckUsec = 1000;
+
+const char* level_tag(LogLevel level)
+{
+    switch (level) {
+    case LogLevel::Debug: return "DEBUG: ";
+    case LogLevel::Info:  return "INFO: ";
+    case LogLevel::Warn:  return "WARN: ";
+    case LogLevel::Error: return "ERROR: ";
+    default:              return "";
+    }
+}
+} // namespace
+
+struct Logger::Impl {
+    LockFreeRingBuffer<LogRecord> records{kLogRingCapacity};
+    // Futex-style wakeup: producers bump wake_seq and notify it, no lock taken.
+    std::atomic<uint32_t> wake_seq{0};
+    std::atomic<bool> writer_idle{false}; // writer waits on wake_seq, ring was empty
+    std::atomic<bool> urgent{false};      // an Error record or a half-full ring
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> submitted{0};
+    std::atomic<uint64_t> written{0};
+    std::atomic<uint64_t> dropped{0};
+    std::thread writer;
+
+    void drain()
+    {
+        LogRecord record;
+        bool wrote_out = false;
+        bool wrote_err = false;
+        while (records.try_pop(record)) {
+            FILE* fp = (record.level >= LogLevel::Warn) ? stderr : stdout;
+            std::fputs(level_tag(record.level), fp);
+            std::fwrite(record.text, 1, record.length, fp);
+            std::fputc('\n', fp);
+            if (fp == stderr) {
+                wrote_err = true;
+            } else {
+                wrote_out = true;
+            }
+            written.fetch_add(1, std::memory_order_release);
+        }
+        if (wrote_out) {
+            std::fflush(stdout);
+        }
+        if (wrote_err) {
+            std::fflush(stderr);
+        }
+    }
+    void wake() noexcept
+    {
+        wake_seq.fetch_add(1, std::memory_order_release);
+        wake_seq.notify_one();
+    }
+    void run()
+    {
+        while (running.load(std::memory_order_acquire)) {
+            // Idle: sleep until a producer pushes into the empty ring. The
+            // fences pair with the one in submit() so that either the producer
+            // sees writer_idle or the writer sees the record.
+            uint32_t seen = wake_seq.load(std::memory_order_acquire);
+            writer_idle.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (records.size() == 0 && running.load(std::memory_order_acquire)) {
+                wake_seq.wait(seen, std::memory_order_acquire);
+            }
+            writer_idle.store(false, std::memory_order_relaxed);
+            // Batch: give the other records up to kLogWriterIntervalUsec, unless one is urgent.
+            for (uint64_t slept = 0; slept < kLogWriterIntervalUsec &&
+                                     !urgent.load(std::memory_order_acquire) &&
+                                     running.load(std::memory_order_acquire);
+                 slept += kLogUrgentCheckUsec) {
+                std::this_thread::sleep_for(std::chrono::microseconds(kLogUrgentCheckUsec));
+            }
+            urgent.store(false, std::memory_order_relaxed);
+            drain();
+        }
+        drain();
+    }
+};
+
+Logger& Logger::instance()
+{
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger() : impl_(new Impl())
+{
+    impl_->writer = std::thread([this]() { impl_->run(); });
+}
+
+Logger::~Logger()
+{
+    impl_->running.store(false, std::memory_order_release);
+    impl_->wake();
+    if (impl_->writer.joinable()) {
+        impl_->writer.join();
+    }
+    delete impl_;
+}
+
+void Logger::submit(const LogRecord& record) noexcept
+{
+    if (!impl_->records.try_push(record)) {
+        impl_->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    impl_->submitted.fetch_add(1, std::memory_order_relaxed);
+    // errors are written promptly; the rest is batched by the writer interval
+    if (record.level >= LogLevel::Error || impl_->records.size() >= kLogRingCapacity / 2) {
+        impl_->urgent.store(true, std::memory_order_release);
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (impl_->writer_idle.load(std::memory_order_relaxed) &&
+        impl_->writer_idle.exchange(false, std::memory_order_relaxed)) {
+        impl_->wake();
+    }
+}
+
+bool Logger::flush(uint64_t timeout_usec) noexcept
+{
+    uint64_t target = impl_->submitted.load(std::memory_order_relaxed);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_usec);
+    while (impl_->written.load(std::memory_order_acquire) < target) {
+        if (!impl_->running.load(std::memory_order_acquire) ||
+            std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        impl_->urgent.store(true, std::memory_order_release);
+        impl_->wake();
+        std::this_thread::sleep_for(std::chrono::microseconds(kLogUrgentCheckUsec / 10));
+    }
+    return true;
+}
+
+uint64_t Logger::dropped_count() const noexcept
+{
+    return impl_->dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace hakoniwa::api
@@ -0,0 +1,476 @@
+#include "hakoniwa/api/client_core.hpp"
+#include "hakoniwa/api/server_core.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <latch>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+/*
+ * RPC round-trip benchmark. Runs a ServerCore and `concurrency` ClientCores
+ * in one process, wired through loopback endpoints (config/bench), and
+ * measures every service from the client side.
+ */
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+// bound on each simulation state change of the start/stop cycle
+constexpr auto kLifecycleStepTimeout = std::chrono::seconds(10);
+
+struct BenchOptions {
+    std::string config_path = "config/bench/remote-api.json";
+    std::string endpoints_path = "config/bench/rpc/endpoints.json";
+    std::string server_node_id = "bench-server";
+    uint32_t concurrency = 1;
+    uint32_t iterations = 1000;
+    uint32_t warmup = 50;
+    uint32_t cycles = 100; // timed start/stop cycles for SimControl and AckEvent
+    std::string output_path; // empty = stdout
+};
+
+struct BenchCase {
+    hakoniwa::api::ServiceId service_id;
+    std::function<bool(hakoniwa::api::ClientCore&)> call;
+};
+
+struct BenchClient {
+    std::string node_id;
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container;
+    std::unique_ptr<hakoniwa::api::ClientCore> client;
+};
+
+// Latencies and failed calls of one service, per client.
+struct CaseSamples {
+    explicit CaseSamples(size_t n) : latencies(n), errors(n, 0) {}
+    std::vector<std::vector<uint64_t>> latencies;
+    std::vector<uint64_t> errors;
+
+    template <typename Call>
+    bool record(size_t i, Call&& call)
+    {
+        auto begin = clock_type::now();
+        bool ok = call();
+        auto end = clock_type::now();
+        latencies[i].push_back(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+        if (!ok) {
+            errors[i]++;
+        }
+        return ok;
+    }
+};
+
+void print_usage(const char* prog)
+{
+    std::cerr << "Usage: " << prog << " [options]" << std::endl;
+    std::cerr << "  --config <path>       remote-api.json (default config/bench/remote-api.json)" << std::endl;
+    std::cerr << "  --endpoints <path>    endpoints.json (default config/bench/rpc/endpoints.json)" << std::endl;
+    std::cerr << "  --server-node <id>    server node ID (default bench-server)" << std::endl;
+    std::cerr << "  --concurrency <n>     clients calling in parallel (default 1)" << std::endl;
+    std::cerr << "  --iterations <n>      timed calls per client per service (default 1000)" << std::endl;
+    std::cerr << "  --warmup <n>          untimed calls per client per service (default 50)" << std::endl;
+    std::cerr << "  --cycles <n>          timed start/stop cycles for SimControl and AckEvent (default 100)" << std::endl;
+    std::cerr << "  --output <path>       write JSON results to a file instead of stdout" << std::endl;
+}
+
+bool parse_options(int argc, const char* argv[], BenchOptions& opt)
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            return false;
+        }
+        std::string value = argv[++i];
+        try {
+            if (arg == "--config") {
+                opt.config_path = value;
+            } else if (arg == "--endpoints") {
+                opt.endpoints_path = value;
+            } else if (arg == "--server-node") {
+                opt.server_node_id = value;
+            } else if (arg == "--concurrency") {
+                opt.concurrency = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--iterations") {
+                opt.iterations = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--warmup") {
+                opt.warmup = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--cycles") {
+                opt.cycles = static_cast<uint32_t>(std::stoul(value));
+            } else if (arg == "--output") {
+                opt.output_path = value;
+            } else {
+                return false;
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return opt.concurrency > 0 && opt.iterations > 0 && opt.cycles > 0;
+}
+
+// Client node IDs of the participants hosted by the server node, in config order.
+std::vector<std::string> participant_node_ids(const BenchOptions& opt)
+{
+    std::vector<std::string> node_ids;
+    std::ifstream ifs(opt.config_path);
+    if (!ifs.is_open()) {
+        return node_ids;
+    }
+    nlohmann::json config = nlohmann::json::parse(ifs, nullptr, false);
+    if (config.is_discarded() || !config.contains("participants") || !config["participants"].is_array()) {
+        return node_ids;
+    }
+    for (const auto& participant : config["participants"]) {
+        if (participant.value("server_nodeId", "") == opt.server_node_id) {
+            node_ids.push_back(participant.value("nodeId", ""));
+        }
+    }
+    return node_ids;
+}
+
+bool init_endpoint_container(const std::shared_ptr<hakoniwa::pdu::EndpointContainer>& container)
+{
+    if (container->initialize() != HakoPduErrorType::HAKO_PDU_ERR_OK) {
+        std::cerr << "Failed to initialize EndpointContainer: " << container->last_error() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+double percentile_usec(const std::vector<uint64_t>& sorted_nsec, uint32_t permille)
+{
+    if (sorted_nsec.empty()) {
+        return 0.0;
+    }
+    size_t rank = (sorted_nsec.size() * permille + 999) / 1000;
+    size_t index = (rank == 0) ? 0 : rank - 1;
+    return static_cast<double>(sorted_nsec[index]) / 1000.0;
+}
+
+nlohmann::json summary_json(const hakoniwa::api::LatencySummary& s)
+{
+    return {
+        {"p50_usec", s.p50_usec},
+        {"p99_usec", s.p99_usec},
+        {"p999_usec", s.p999_usec},
+        {"max_usec", s.max_usec},
+    };
+}
+
+nlohmann::json summarize(hakoniwa::api::ServiceId service_id, const CaseSamples& samples, double wall_sec)
+{
+    std::vector<uint64_t> all;
+    uint64_t error_count = 0;
+    for (size_t i = 0; i < samples.latencies.size(); i++) {
+        all.insert(all.end(), samples.latencies[i].begin(), samples.latencies[i].end());
+        error_count += samples.errors[i];
+    }
+    std::sort(all.begin(), all.end());
+    double sum_usec = 0.0;
+    for (uint64_t v : all) {
+        sum_usec += static_cast<double>(v) / 1000.0;
+    }
+
+    nlohmann::json result;
+    result["service"] = std::string(hakoniwa::api::service_name_of(service_id));
+    result["calls"] = all.size();
+    result["errors"] = error_count;
+    result["wall_sec"] = wall_sec;
+    result["throughput_rps"] = (wall_sec > 0.0) ? static_cast<double>(all.size()) / wall_sec : 0.0;
+    result["mean_usec"] = all.empty() ? 0.0 : sum_usec / static_cast<double>(all.size());
+    result["p50_usec"] = percentile_usec(all, 500);
+    result["p99_usec"] = percentile_usec(all, 990);
+    result["p999_usec"] = percentile_usec(all, 999);
+    result["max_usec"] = all.empty() ? 0.0 : static_cast<double>(all.back()) / 1000.0;
+    return result;
+}
+
+nlohmann::json run_case(const BenchCase& bench_case, std::vector<BenchClient>& clients, const BenchOptions& opt)
+{
+    const size_t n = clients.size();
+    CaseSamples samples(n);
+    std::latch ready(static_cast<std::ptrdiff_t>(n + 1));
+    std::latch go(1);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < n; i++) {
+        threads.emplace_back([&, i]() {
+            auto& client = *clients[i].client;
+            samples.latencies[i].reserve(opt.iterations);
+            for (uint32_t w = 0; w < opt.warmup; w++) {
+                (void)bench_case.call(client);
+            }
+            ready.count_down();
+            go.wait();
+            for (uint32_t k = 0; k < opt.iterations; k++) {
+                samples.record(i, [&]() { return bench_case.call(client); });
+            }
+        });
+    }
+    ready.arrive_and_wait();
+    auto wall_begin = clock_type::now();
+    go.count_down();
+    for (auto& t : threads) {
+        t.join();
+    }
+    double wall_sec = std::chrono::duration<double>(clock_type::now() - wall_begin).count();
+    return summarize(bench_case.service_id, samples, wall_sec);
+}
+
+// Long-polls GetEvent until the client's asset reports `expected`.
+bool wait_event(hakoniwa::api::ClientCore& client, hakoniwa::api::HakoSimulationAssetEvent expected)
+{
+    auto deadline = clock_type::now() + kLifecycleStepTimeout;
+    while (clock_type::now() < deadline) {
+        hakoniwa::api::HakoSimulationAssetEvent event;
+        if (!client.get_event(event, 100)) {
+            return false;
+        }
+        if (event == expected) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool wait_state(hakoniwa::api::ClientCore& client, hakoniwa::api::HakoSimulationState expected)
+{
+    auto deadline = clock_type::now() + kLifecycleStepTimeout;
+    while (clock_type::now() < deadline) {
+        hakoniwa::api::HakoSimulationStateInfo state;
+        if (!client.get_sim_state(state)) {
+            return false;
+        }
+        if (state.sim_state == expected) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+/*
+ * SimControl and AckEvent only do real work when they match the simulation
+ * state, so they are measured over start/stop cycles instead of in a loop:
+ * client 0 sends Start to the stopped simulation, every client acknowledges
+ * the Start event of its asset, and once the simulation runs client 0 sends
+ * Stop and every client acknowledges the Stop event. One untimed cycle is
+ * followed by opt.cycles timed ones. Only the SimControl and AckEvent calls
+ * are timed; wall_sec includes the state changes in between. Stops at the
+ * first failed step, which is counted under "errors".
+ */
+std::vector<nlohmann::json> run_lifecycle(std::vector<BenchClient>& clients, const BenchOptions& opt)
+{
+    using hakoniwa::api::HakoSimulationAssetEvent;
+    using hakoniwa::api::HakoSimulationControlCommand;
+    using hakoniwa::api::HakoSimulationState;
+    struct Phase {
+        HakoSimulationControlCommand command;
+        HakoSimulationAssetEvent event;
+        HakoSimulationState reached;
+    };
+    const Phase phases[] = {
+        {HakoSimulationControlCommand::HakoSimControl_Start, HakoSimulationAssetEvent::HakoSimAssetEvent_Start,
+         HakoSimulationState::HakoSim_Running},
+        {HakoSimulationControlCommand::HakoSimControl_Stop, HakoSimulationAssetEvent::HakoSimAssetEvent_Stop,
+         HakoSimulationState::HakoSim_Stopped},
+    };
+    const size_t n = clients.size();
+    CaseSamples sim_control(n);
+    CaseSamples ack_event(n);
+    CaseSamples discard(n); // warmup cycle
+    std::atomic<bool> failed{!wait_state(*clients[0].client, HakoSimulationState::HakoSim_Stopped)};
+    std::barrier sync(static_cast<std::ptrdiff_t>(n));
+    std::vector<std::thread> threads;
+
+    auto wall_begin = clock_type::now();
+    for (size_t i = 0; i < n; i++) {
+        threads.emplace_back([&, i]() {
+            auto& client = *clients[i].client;
+            for (uint32_t k = 0; k < 1 + opt.cycles; k++) {
+                bool timed = k > 0;
+                if (k == 1 && i == 0) {
+                    wall_begin = clock_type::now();
+                }
+                for (const Phase& phase : phases) {
+                    if (i == 0 && !failed &&
+                        !(timed ? sim_control : discard).record(i, [&]() { return client.sim_control(phase.command); })) {
+                        failed = true;
+                    }
+                    if (!failed && !wait_event(client, phase.event)) {
+                        failed = true;
+                        (timed ? ack_event : discard).errors[i]++;
+                    }
+                    if (!failed &&
+                        !(timed ? ack_event : discard).record(i, [&]() { return client.ack_event(phase.event); })) {
+                        failed = true;
+                    }
+                    sync.arrive_and_wait();
+                    if (i == 0 && !failed && !wait_state(client, phase.reached)) {
+                        failed = true;
+                        (timed ? sim_control : discard).errors[i]++;
+                    }
+                    sync.arrive_and_wait();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    double wall_sec = std::chrono::duration<double>(clock_type::now() - wall_begin).count();
+    if (failed) {
+        std::cerr << "Start/stop cycle failed; SimControl and AckEvent results are partial." << std::endl;
+    }
+    return {summarize(hakoniwa::api::ServiceId::SimControl, sim_control, wall_sec),
+            summarize(hakoniwa::api::ServiceId::AckEvent, ack_event, wall_sec)};
+}
+
+} // namespace
+
+int main(int argc, const char* argv[]) {
+    BenchOptions opt;
+    if (!parse_options(argc, argv, opt)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    std::vector<std::string> node_ids = participant_node_ids(opt);
+    if (node_ids.size() < opt.concurrency) {
+        std::cerr << "Config has " << node_ids.size() << " participants for server node '" << opt.server_node_id
+                  << "', but concurrency is " << opt.concurrency << "." << std::endl;
+        return 1;
+    }
+
+    // server
+    auto server_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(opt.server_node_id, opt.endpoints_path);
+    hakoniwa::api::ServerCore server(opt.config_path, opt.server_node_id, true);
+    if (!init_endpoint_container(server_container)) {
+        return 1;
+    }
+    if (!server.initialize(server_container)) {
+        std::cerr << "Server initialization failed: " << server.last_error() << std::endl;
+        return 1;
+    }
+    if (!server.initialize_rpc_services()) {
+        std::cerr << "Server RPC initialization failed: " << server.last_error() << std::endl;
+        return 1;
+    }
+    if (server_container->start_all() != HakoPduErrorType::HAKO_PDU_ERR_OK) {
+        std::cerr << "Failed to start server endpoints: " << server_container->last_error() << std::endl;
+        return 1;
+    }
+    if (!server.start()) {
+        std::cerr << "Server start failed: " << server.last_error() << std::endl;
+        return 1;
+    }
+
+    // clients
+    std::vector<BenchClient> clients(opt.concurrency);
+    for (uint32_t i = 0; i < opt.concurrency; i++) {
+        auto& c = clients[i];
+        c.node_id = node_ids[i];
+        c.endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(c.node_id, opt.endpoints_path);
+        c.client = std::make_unique<hakoniwa::api::ClientCore>(c.node_id, opt.config_path);
+        if (!init_endpoint_container(c.endpoint_container)) {
+            return 1;
+        }
+        if (!c.client->initialize(c.endpoint_container)) {
+            std::cerr << "Client '" << c.node_id << "' initialization failed: " << c.client->last_error() << std::endl;
+            return 1;
+        }
+        if (c.endpoint_container->start_all() != HakoPduErrorType::HAKO_PDU_ERR_OK) {
+            std::cerr << "Failed to start client endpoints: " << c.endpoint_container->last_error() << std::endl;
+            return 1;
+        }
+        if (!c.client->start()) {
+            std::cerr << "Client '" << c.node_id << "' start failed: " << c.client->last_error() << std::endl;
+            return 1;
+        }
+    }
+    while (!server_container->is_running_all()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    for (auto& c : clients) {
+        while (!c.endpoint_container->is_running_all() || !c.client->is_pdu_end_point_running()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (!c.client->join()) {
+            std::cerr << "Client '" << c.node_id << "' join failed: " << c.client->last_error() << std::endl;
+            return 1;
+        }
+    }
+
+    // SimControl and AckEvent are measured by run_lifecycle().
+    using hakoniwa::api::ServiceId;
+    const std::vector<BenchCase> cases = {
+        {ServiceId::Join, [](hakoniwa::api::ClientCore& c) { return c.join(); }},
+        {ServiceId::GetSimState, [](hakoniwa::api::ClientCore& c) {
+            hakoniwa::api::HakoSimulationStateInfo state;
+            return c.get_sim_state(state);
+        }},
+        {ServiceId::GetEvent, [](hakoniwa::api::ClientCore& c) {
+            hakoniwa::api::HakoSimulationAssetEvent event;
+            return c.get_event(event);
+        }},
+    };
+
+    nlohmann::json results;
+    results["concurrency"] = opt.concurrency;
+    results["iterations"] = opt.iterations;
+    results["warmup"] = opt.warmup;
+    results["cycles"] = opt.cycles;
+    results["services"] = nlohmann::json::array();
+    std::vector<nlohmann::json> service_results;
+    for (const auto& bench_case : cases) {
+        service_results.push_back(run_case(bench_case, clients, opt));
+    }
+    for (auto& r : run_lifecycle(clients, opt)) {
+        service_results.push_back(std::move(r));
+    }
+    for (auto& r : service_results) {
+        std::cerr << r["service"].get<std::string>() << ": " << r["throughput_rps"].get<double>() << " req/s, p50="
+                  << r["p50_usec"].get<double>() << " p99=" << r["p99_usec"].get<double>()
+                  << " p99.9=" << r["p999_usec"].get<double>() << " usec, errors=" << r["errors"].get<uint64_t>()
+                  << std::endl;
+        results["services"].push_back(std::move(r));
+    }
+    results["server"] = nlohmann::json::array();
+    for (const auto& s : server.stats()) {
+        results["server"].push_back({
+            {"service", s.service_name},
+            {"count", s.total.count},
+            {"rejected", s.rejected},
+            {"queue_wait", summary_json(s.queue_wait)},
+            {"handler", summary_json(s.handler)},
+            {"reply", summary_json(s.reply)},
+            {"total", summary_json(s.total)},
+        });
+    }
+
+    for (auto& c : clients) {
+        c.client->stop();
+        c.endpoint_container->stop_all();
+    }
+    server.stop();
+    server_container->stop_all();
+
+    if (opt.output_path.empty()) {
+        std::cout << results.dump(2) << std::endl;
+    } else {
+        std::ofstream ofs(opt.output_path);
+        if (!ofs.is_open()) {
+            std::cerr << "Failed to open output file: " << opt.output_path << std::endl;
+            return 1;
+        }
+        ofs << results.dump(2) << std::endl;
+    }
+    return 0;
+}
@@ -65,6 +65,24 @@ int main(int argc, const char* argv[]) {
                           << ", is_pdu_sync_mode=" << state.is_pdu_sync_mode << std::endl;
             }
         }
+        else if (input.rfind("stats:", 0) == 0) {
+            std::string service_name = "HakoRemoteApi/" + input.substr(6);
+            hakoniwa::api::ServiceStats stats;
+            if (!client.get_server_stats(service_name, stats)) {
+                std::cerr << "GetServerStats failed: " << client.last_error() << std::endl;
+            } else {
+                auto print = [](const char* label, const hakoniwa::api::LatencySummary& s) {
+                    std::cout << "  " << label << ": p50=" << s.p50_usec << " p99=" << s.p99_usec
+                              << " p99.9=" << s.p999_usec << " max=" << s.max_usec << " usec" << std::endl;
+                };
+                std::cout << stats.service_name << ": count=" << stats.total.count
+                          << ", rejected=" << stats.rejected << std::endl;
+                print("queue_wait", stats.queue_wait);
+                print("handler   ", stats.handler);
+                print("reply     ", stats.reply);
+                print("total     ", stats.total);
+            }
+        }
         else if (input == "g:event") {
             hakoniwa::api::HakoSimulationAssetEvent event;
             if (!client.get_event(event)) {
@@ -73,6 +91,15 @@ int main(int argc, const char* argv[]) {
                 std::cout << "Received event: " << static_cast<int>(event) << std::endl;
             }
         }
+        else if (input == "w:event") {
+            // long poll: the server answers as soon as an event occurs
+            hakoniwa::api::HakoSimulationAssetEvent event;
+            if (!client.get_event(event, 5000)) {
+                std::cerr << "GetEvent failed: " << client.last_error() << std::endl;
+            } else {
+                std::cout << "Received event: " << static_cast<int>(event) << std::endl;
+            }
+        }
         else if ((input == "c:start") ||
                  (input == "c:stop") ||
                  (input == "c:reset")) {
@@ -117,6 +144,37 @@ int main(int argc, const char* argv[]) {
                 std::cout << event_name << " event acknowledged successfully." << std::endl;
             }
         }
+        else if (input == "sub") {
+            // the callback runs on the client I/O thread
+            client.subscribe_events([](const hakoniwa::api::CallResult<hakoniwa::api::HakoSimulationAssetEvent>& result) {
+                if (!result.ok) {
+                    std::cerr << "Event subscription ended: " << result.error << std::endl;
+                } else {
+                    std::cout << "Pushed event: " << static_cast<int>(result.value) << std::endl;
+                }
+            });
+            std::cout << "Subscribed to asset events." << std::endl;
+        }
+        else if (input == "unsub") {
+            client.unsubscribe_events();
+            std::cout << "Unsubscribed from asset events." << std::endl;
+        }
+        else if (input == "step") {
+            // GetEvent + AckEvent + GetSimState in one round trip
+            hakoniwa::api::BatchReply reply;
+            if (!client.batch().get_event().ack_last_event().get_sim_state().send(reply)) {
+                std::cerr << "Batch failed: " << client.last_error() << std::endl;
+            } else {
+                for (const auto& result : reply.results) {
+                    std::cout << "  " << hakoniwa::api::service_name_of(result.op)
+                              << ": result_code=" << result.result_code << ", value=" << result.value << std::endl;
+                }
+                if (reply.sim_state) {
+                    std::cout << "Simulation State: time=" << reply.sim_state->master_time
+                              << " usec, status=" << static_cast<int>(reply.sim_state->sim_state) << std::endl;
+                }
+            }
+        }
         else if (input == "q" || input == "quit" || input == "exit") {
             std::cout << "Exiting..." << std::endl;
             break;
@@ -126,12 +184,16 @@ int main(int argc, const char* argv[]) {
             std::cout << "  join          - Join the simulation" << std::endl;
             std::cout << "  state         - Get simulation state" << std::endl;
             std::cout << "  g:event       - Get next event" << std::endl;
+            std::cout << "  w:event       - Wait up to 5 s for the next event (long poll)" << std::endl;
             std::cout << "  c:start       - Send Start control command" << std::endl;
             std::cout << "  c:stop        - Send Stop control command" << std::endl;
             std::cout << "  c:reset       - Send Reset control command" << std::endl;
             std::cout << "  a:start       - Acknowledge Start event" << std::endl;
             std::cout << "  a:stop        - Acknowledge Stop event" << std::endl;
             std::cout << "  a:reset       - Acknowledge Reset event" << std::endl;
+            std::cout << "  stats:<name>  - Get server latency stats, e.g. stats:GetSimState" << std::endl;
+            std::cout << "  sub / unsub   - Subscribe to / unsubscribe from pushed asset events" << std::endl;
+            std::cout << "  step          - Get, acknowledge the next event and get state in one batch" << std::endl;
             std::cout << "  q, quit, exit - Exit the program" << std::endl;
         }
     }
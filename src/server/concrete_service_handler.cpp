@@ -1,83 +1,328 @@
 #include "concrete_service_handler.hpp"
+#include "hakoniwa/api/logger.hpp"
 #include "hakoniwa/hakoniwa_asset_polling.h"
 #include "hakoniwa/pdu/rpc/rpc_service_helper.hpp"
 
+#include <optional>
+#include <random>
+#include <string_view>
+
 #include "hako_srv_msgs/pdu_cpptype_conv_AckEventRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_AckEventResponsePacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_BatchRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_BatchResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetEventRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetEventResponsePacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_GetServerStatsRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_GetServerStatsResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetSimStateRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_GetSimStateResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_JoinRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_JoinResponsePacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_SimControlRequestPacket.hpp"
 #include "hako_srv_msgs/pdu_cpptype_conv_SimControlResponsePacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_SubscribeEventsRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cpptype_conv_SubscribeEventsResponsePacket.hpp"
+
+#include "hako_srv_msgs/pdu_cppview_AckEventRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_BatchRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_GetEventRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_GetServerStatsRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_GetSimStateRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_JoinRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_SimControlRequestPacket.hpp"
+#include "hako_srv_msgs/pdu_cppview_SubscribeEventsRequestPacket.hpp"
 
 namespace hakoniwa::api {
 
-// Helper function to validate client node ID
-static bool validate_client_id(ServerContext &service_context,
-                               const std::string &client_name,
-                               Hako_int32 &result_code) {
-  if (client_name != service_context.get_client_name()) {
-    std::cerr << "WARNING: Client Name mismatch. Expected '"
-              << service_context.get_client_name() << "', got '"
-              << client_name << "'." << std::endl;
+namespace msgs = hako::pdu::msgs::hako_srv_msgs;
+
+// Per-worker reusable helper and response objects. Every handler worker
+// thread owns one set per service, so a steady-state reply reuses the same
+// objects (and their string capacity) instead of constructing new ones.
+// Requests are not converted at all; see request_view().
+template <typename ServiceHelper, typename ResponseBody>
+struct WorkerScratch {
+  ServiceHelper service_helper;
+  ResponseBody response_body{};
+};
+#define HakoWorkerScratchType(name)                                            \
+  WorkerScratch<HakoRpcServiceServerTemplateType(name), HakoCpp_##name##Response>
+
+template <typename Scratch> static Scratch &worker_scratch() {
+  thread_local Scratch scratch;
+  return scratch;
+}
+
+// Read the request body in place in the received PDU instead of converting
+// it into a HakoCpp_* struct: no copy, and no std::string per string field.
+// nullopt if the PDU is malformed or too short.
+template <typename PacketView>
+static auto request_view(const pdu::rpc::RpcRequest &request)
+    -> std::optional<decltype(std::declval<PacketView>().body())> {
+  auto packet = PacketView::from_pdu(
+      reinterpret_cast<const char *>(request.pdu.data()), request.pdu.size());
+  if (!packet) {
+    return std::nullopt;
+  }
+  return packet->body();
+}
+
+// The hakoniwa C API takes NUL-terminated names; a per-thread buffer keeps
+// this allocation-free once it has grown to the longest name.
+static const char *asset_cstr(std::string_view asset_name) {
+  thread_local std::string buffer;
+  buffer.assign(asset_name);
+  return buffer.c_str();
+}
+
+// Reply and stamp the handler-end / reply-sent points of the request trace.
+template <typename ServiceHelper, typename ResponseBody>
+static void reply_traced(ServiceHelper &service_helper,
+                         pdu::rpc::RpcServicesServer &service_rpc,
+                         pdu::rpc::RpcRequest &request, Hako_int32 result_code,
+                         ResponseBody &response_body, RequestTrace &trace) {
+  trace.handled_usec = steady_now_usec();
+  service_helper.reply(service_rpc, request,
+                       hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
+                       result_code, response_body);
+  trace.replied_usec = steady_now_usec();
+}
+
+// Helper function to look up and validate the requesting client
+static ClientContext *validate_client_id(ServerContext &service_context,
+                                         const std::string &client_name,
+                                         Hako_int32 &result_code) {
+  ClientContext *client = service_context.find_client(client_name);
+  if (client == nullptr) {
+    HAKO_LOG_WARN("Unknown client name '" << client_name << "'.");
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+    return nullptr;
+  }
+  client->count_request();
+  return client;
+}
+
+static void count_result(ClientContext *client, Hako_int32 result_code) {
+  if (client != nullptr &&
+      result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+    client->count_error();
+  }
+}
+
+// The asset name in a request body must be the one the participant joined
+// with; otherwise a participant could read or acknowledge another's events.
+static bool validate_asset_name(const ClientContext &client,
+                                std::string_view asset_name,
+                                Hako_int32 &result_code) {
+  if (asset_name != client.get_node_id()) {
+    HAKO_LOG_ERROR("Client '" << client.get_name() << "' named asset '" << asset_name
+                   << "', but joined as '" << client.get_node_id() << "'.");
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
     return false;
   }
   return true;
 }
 
-void JoinHandler::handle(ServerContext &service_context,
-                         std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
-                         pdu::rpc::RpcRequest &request) {
-  HakoRpcServiceServerTemplateType(Join) service_helper;
-  std::string message = "Join request Succeeded.";
-  std::cout << "Handling join request from client: " << request.client_name
-            << std::endl;
+// The operations below are shared by the single-operation handlers and
+// BatchHandler; each returns the result code of that one operation.
 
-  Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
-  HakoCpp_JoinRequest request_body;
+template <typename ResponseBody>
+static void fill_sim_state(ClientContext &client, ResponseBody &response_body) {
+  response_body.master_time = static_cast<int64_t>(hakoniwa_asset_get_worldtime());
+  response_body.is_pdu_created = hakoniwa_asset_is_pdu_created() != 0;
+  response_body.is_simulation_mode = hakoniwa_asset_is_simulation_mode() != 0;
+  response_body.is_pdu_sync_mode = hakoniwa_asset_is_pdu_sync_mode(client.get_node_id().c_str()) != 0;
+}
 
-  // Validate state
-  {
-    std::lock_guard<std::mutex> lock(service_context.get_mutex());
-    if (service_context.get_status() !=
-        ServerServiceContextStatus::SERVER_SERVICE_NOT_READY) {
-      result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
-      message = "Server service is not ready.";
+static Hako_int32 run_sim_control(Hako_uint32 op_code, const char **message) {
+  int ret = -1;
+  auto op = static_cast<HakoSimulationControlCommand>(op_code);
+  switch (op) {
+  case HakoSimulationControlCommand::HakoSimControl_Start:
+    ret = hakoniwa_simevent_start();
+    break;
+  case HakoSimulationControlCommand::HakoSimControl_Stop:
+    ret = hakoniwa_simevent_stop();
+    break;
+  case HakoSimulationControlCommand::HakoSimControl_Reset:
+    ret = hakoniwa_simevent_reset();
+    break;
+  default:
+    HAKO_LOG_ERROR("Invalid SimControl operation: " << op_code);
+    *message = "Invalid SimControl operation.";
+    return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  }
+  if (ret != 0) {
+    HAKO_LOG_ERROR("Failed to execute SimControl operation: " << op_code);
+    *message = "Failed to execute SimControl operation.";
+    return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
+  }
+  return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+}
+
+static Hako_int32 run_get_event(std::string_view asset_name,
+                                Hako_uint32 &event_code) {
+  int ret = hakoniwa_asset_get_event(asset_cstr(asset_name));
+  if (static_cast<HakoSimulationAssetEvent>(ret) ==
+      HakoSimulationAssetEvent::HakoSimAssetEvent_Error) {
+    HAKO_LOG_ERROR("hakoniwa_asset_get_event() failed for asset '" << asset_name << "'.");
+    return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
+  }
+  event_code = static_cast<Hako_uint32>(ret);
+  return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+}
+
+HakoPduErrorType SimLifecycle::prepare_start() {
+  if (start_prepared_) {
+    return HAKO_PDU_ERR_OK;
+  }
+  hakoniwa_asset_load_pdu_data();//load pdu data..
+  if (post_start_cb_) {
+    HakoPduErrorType err = post_start_cb_();
+    if (err != HakoPduErrorType::HAKO_PDU_ERR_OK) {
+      HAKO_LOG_ERROR("post_start_all failed with code: " << static_cast<int>(err));
+      return err;
     }
   }
+  start_prepared_ = true;
+  return HAKO_PDU_ERR_OK;
+}
 
-  // Validate client ID and request body
-  if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-    if (!validate_client_id(service_context, request.client_name,
-                            result_code)) {
-      message = "Client node ID mismatch.";
-    } else if (!service_helper.get_request_body(request, request_body)) {
-      std::cerr << "ERROR: Failed to get join request body." << std::endl;
-      result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
-      message = "Invalid join request body.";
+// The caller holds lifecycle.mutex().
+static Hako_int32
+run_ack_event(std::string_view asset_name, Hako_uint32 event_code,
+              SimLifecycle &lifecycle) {
+  int ret = -1;
+  auto event = static_cast<HakoSimulationAssetEvent>(event_code);
+  auto state = hakoniwa_simevent_get_state();
+  HAKO_LOG_INFO("Current simulation state: " << state);
+  switch (event) {
+  case HakoSimulationAssetEvent::HakoSimAssetEvent_Start:
+    HAKO_LOG_INFO("Acknowledging start event for asset '" << asset_name << "'.");
+
+    if (lifecycle.prepare_start() != HakoPduErrorType::HAKO_PDU_ERR_OK) {
+      return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
     }
+
+    ret = hakoniwa_asset_start_feedback_ok(asset_cstr(asset_name));
+    if (ret == 0) {
+      HAKO_LOG_INFO("Asset '" << asset_name << "' start acknowledged.");
+    }
+    else {
+      HAKO_LOG_ERROR("Asset '" << asset_name << "' start feedback failed. ret = " << ret);
+    }
+    break;
+  case HakoSimulationAssetEvent::HakoSimAssetEvent_Stop:
+    lifecycle.end_run();
+    ret = hakoniwa_asset_stop_feedback_ok(asset_cstr(asset_name));
+    if (ret == 0) {
+      HAKO_LOG_INFO("Asset '" << asset_name << "' stop acknowledged.");
+    }
+    else {
+      HAKO_LOG_ERROR("Asset '" << asset_name << "' stop feedback failed. ret = " << ret);
+    }
+    break;
+  case HakoSimulationAssetEvent::HakoSimAssetEvent_Reset:
+    lifecycle.end_run();
+    ret = hakoniwa_asset_reset_feedback_ok(asset_cstr(asset_name));
+    if (ret == 0) {
+      HAKO_LOG_INFO("Asset '" << asset_name << "' reset acknowledged.");
+    }
+    else {
+      HAKO_LOG_ERROR("Asset '" << asset_name << "' reset feedback failed. ret = " << ret);
+    }
+    break;
+  default:
+    HAKO_LOG_ERROR("AckEvent request contains unknown event code: " << event_code);
+    return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  }
+
+  if (ret != 0) {
+    HAKO_LOG_ERROR("hako_asset_*_feedback failed for event " << event_code);
+    return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
   }
+  return hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+}
 
-  // Register asset
+// Nonzero, unpredictable per server run; 0 in a Join request means "new session".
+static Hako_uint64 new_session_token() {
+  thread_local std::mt19937_64 rng{std::random_device{}()};
+  Hako_uint64 token = 0;
+  while (token == 0) {
+    token = rng();
+  }
+  return token;
+}
+
+void JoinHandler::handle(ServerContext &service_context,
+                         std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+                         pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(Join)>();
+  auto &service_helper = scratch.service_helper;
+  const char *message = "Join request Succeeded.";
+  HAKO_LOG_INFO("Handling join request from client: " << request.client_name);
+
+  Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+  std::optional<msgs::JoinRequestView> request_body;
+
+  // Validate client ID and request body
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
+    message = "Unknown client name.";
+  } else if (!(request_body = request_view<msgs::JoinRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get join request body.");
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+    message = "Invalid join request body.";
+  }
+
+  // Validate state and register asset, or resume the client's session
+  Hako_uint64 session_token = 0;
   if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-    if (hakoniwa_asset_register_polling(
-            service_context.get_client_node_id().c_str()) != 0) {
-      std::cerr << "ERROR: Failed to register asset polling for client '"
-                << service_context.get_client_node_id() << "'." << std::endl;
+    std::lock_guard<std::mutex> lock(client->get_mutex());
+    if (client->get_status() ==
+            ServerServiceContextStatus::SERVER_SERVICE_STARTED &&
+        request_body->session_token() != 0 &&
+        request_body->session_token() == client->get_session_token()) {
+      HAKO_LOG_INFO("Client '" << client->get_name() << "' resumed its session.");
+      message = "Join session resumed.";
+      session_token = client->get_session_token();
+    } else if (client->get_status() !=
+        ServerServiceContextStatus::SERVER_SERVICE_NOT_READY) {
+      result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
+      message = "Server service is not ready.";
+    } else if (hakoniwa_asset_register_polling(
+                   client->get_node_id().c_str()) != 0) {
+      HAKO_LOG_ERROR("Failed to register asset polling for client '" << client->get_node_id() << "'.");
       result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
       message = "Failed to register asset polling.";
     } else {
-        service_context.set_status(ServerServiceContextStatus::SERVER_SERVICE_STARTED);
+      client->set_asset_registered(true);
+      client->set_status(ServerServiceContextStatus::SERVER_SERVICE_STARTED);
+      client->set_session_token(new_session_token());
+      session_token = client->get_session_token();
     }
   }
+  count_result(client, result_code);
 
-  HakoCpp_JoinResponse response_body;
+  auto &response_body = scratch.response_body;
   response_body.status_code = result_code;
   response_body.message = message;
+  response_body.session_token = session_token;
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
+
+void JoinHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(Join)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body.status_code = result_code;
+  response_body.message = "Join request rejected.";
+  response_body.session_token = 0;
   service_helper.reply(*service_rpc, request,
                        hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
                        result_code, response_body);
@@ -86,33 +331,45 @@ void JoinHandler::handle(ServerContext &service_context,
 void GetSimStateHandler::handle(
     ServerContext &service_context,
     std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
-    pdu::rpc::RpcRequest &request) {
-  HakoRpcServiceServerTemplateType(GetSimState) service_helper;
-  //std::cout << "Handling get_sim_state request from client: "
-  //           << request.client_name << std::endl;
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetSimState)>();
+  auto &service_helper = scratch.service_helper;
+  HAKO_LOG_DEBUG("Handling get_sim_state request from client: " << request.client_name);
 
   Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
-  HakoCpp_GetSimStateRequest request_body;
+  std::optional<msgs::GetSimStateRequestView> request_body;
 
-  if (!validate_client_id(service_context, request.client_name, result_code)) {
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
     // Error handled in helper
-  } else if (!service_helper.get_request_body(request, request_body)) {
-    std::cerr << "ERROR: Failed to get get_sim_state request body."
-              << std::endl;
+  } else if (!(request_body = request_view<msgs::GetSimStateRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get get_sim_state request body.");
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
   }
 
-  HakoCpp_GetSimStateResponse response_body;
+  auto &response_body = scratch.response_body;
+  response_body = {};
   if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
     response_body.sim_state =
         static_cast<Hako_uint32>(hakoniwa_simevent_get_state());
-    response_body.master_time = static_cast<int64_t>(hakoniwa_asset_get_worldtime());
-    response_body.is_pdu_created = hakoniwa_asset_is_pdu_created() != 0;
-    response_body.is_simulation_mode = hakoniwa_asset_is_simulation_mode() != 0;
-    response_body.is_pdu_sync_mode = hakoniwa_asset_is_pdu_sync_mode(service_context.get_client_node_id().c_str()) != 0;
+    fill_sim_state(*client, response_body);
   } else {
     response_body.sim_state = -1; // Indicate error
   }
+  count_result(client, result_code);
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
+
+void GetSimStateHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetSimState)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  response_body.sim_state = -1; // Indicate error
   service_helper.reply(*service_rpc, request,
                        hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
                        result_code, response_body);
@@ -121,53 +378,44 @@ void GetSimStateHandler::handle(
 void SimControlHandler::handle(
     ServerContext &service_context,
     std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
-    pdu::rpc::RpcRequest &request) {
-  HakoRpcServiceServerTemplateType(SimControl) service_helper;
-  std::string message = "SimControl request Succeeded.";
-  std::cout << "Handling sim_control request from client: "
-            << request.client_name << std::endl;
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(SimControl)>();
+  auto &service_helper = scratch.service_helper;
+  const char *message = "SimControl request Succeeded.";
+  HAKO_LOG_INFO("Handling sim_control request from client: " << request.client_name);
 
   Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
-  HakoCpp_SimControlRequest request_body;
-
-  if (!validate_client_id(service_context, request.client_name, result_code)) {
-    message = "Client node ID mismatch.";
-  } else if (!service_helper.get_request_body(request, request_body)) {
-    std::cerr << "ERROR: Failed to get SimControl request body." << std::endl;
+  std::optional<msgs::SimControlRequestView> request_body;
+
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
+    message = "Unknown client name.";
+  } else if (!(request_body = request_view<msgs::SimControlRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get SimControl request body.");
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
     message = "Invalid SimControl request body.";
   } else {
-    int ret = -1;
-    auto op = static_cast<HakoSimulationControlCommand>(request_body.op);
-    switch (op) {
-    case HakoSimulationControlCommand::HakoSimControl_Start:
-      ret = hakoniwa_simevent_start();
-      break;
-    case HakoSimulationControlCommand::HakoSimControl_Stop:
-      ret = hakoniwa_simevent_stop();
-      break;
-    case HakoSimulationControlCommand::HakoSimControl_Reset:
-      ret = hakoniwa_simevent_reset();
-      break;
-    default:
-      std::cerr << "ERROR: Invalid SimControl operation: " << request_body.op
-                << std::endl;
-      result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
-      message = "Invalid SimControl operation.";
-      break;
-    }
-
-    if ((result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) && (ret != 0)) {
-      std::cerr << "ERROR: Failed to execute SimControl operation: "
-                << request_body.op << std::endl;
-      result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
-      message = "Failed to execute SimControl operation.";
-    }
+    std::lock_guard<std::mutex> lock(lifecycle_->mutex());
+    result_code = run_sim_control(request_body->op(), &message);
   }
+  count_result(client, result_code);
 
-  HakoCpp_SimControlResponse response_body;
+  auto &response_body = scratch.response_body;
   response_body.status_code = result_code;
   response_body.message = message;
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
+
+void SimControlHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(SimControl)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body.status_code = result_code;
+  response_body.message = "SimControl request rejected.";
   service_helper.reply(*service_rpc, request,
                        hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
                        result_code, response_body);
@@ -176,139 +424,467 @@ void SimControlHandler::handle(
 void GetEventHandler::handle(
     ServerContext &service_context,
     std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
-    pdu::rpc::RpcRequest &request) {
-  HakoRpcServiceServerTemplateType(GetEvent) service_helper;
-  //std::cout << "Handling get_event request from client: " << request.client_name
-  //          << std::endl;
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetEvent)>();
+  auto &service_helper = scratch.service_helper;
+  HAKO_LOG_DEBUG("Handling get_event request from client: " << request.client_name);
 
   Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
-  HakoCpp_GetEventRequest request_body;
-  HakoCpp_GetEventResponse response_body;
-
-  if (!validate_client_id(service_context, request.client_name, result_code)) {
-    std::cerr << "ERROR: Client ID validation failed." << std::endl;
+  std::optional<msgs::GetEventRequestView> request_body;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
+    HAKO_LOG_ERROR("Client ID validation failed.");
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
-  } else if (!service_helper.get_request_body(request, request_body)) {
-    std::cerr << "ERROR: Failed to get GetEvent request body." << std::endl;
+  } else if (!(request_body = request_view<msgs::GetEventRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get GetEvent request body.");
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  } else if (!validate_asset_name(*client, request_body->name(), result_code)) {
+    // Error set in helper
   }
   
   if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-    int event_code = hakoniwa_asset_get_event(request_body.name.c_str());
-    if (static_cast<HakoSimulationAssetEvent>(event_code) ==
-        HakoSimulationAssetEvent::HakoSimAssetEvent_Error) {
-      std::cerr << "ERROR: hakoniwa_asset_get_event() failed for client '"
-                << request.client_name << "'." << std::endl;
-      result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
-    } else {
-      response_body.event_code = static_cast<Hako_uint32>(event_code);
+    result_code = run_get_event(client->get_node_id(), response_body.event_code);
+  }
+  count_result(client, result_code);
+
+  if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK &&
+      request_body->wait_timeout_msec() > 0 &&
+      static_cast<HakoSimulationAssetEvent>(response_body.event_code) ==
+          HakoSimulationAssetEvent::HakoSimAssetEvent_None) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = waiters_.find(request.client_name);
+    if (it != waiters_.end()) {
+      // The client gave up on the previous one; answer it so it is not leaked.
+      reply_waiter(it->second, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED,
+                   response_body.event_code);
+    }
+    uint64_t now_usec = steady_now_usec();
+    waiters_[request.client_name] = {std::move(service_rpc), request, client->get_node_id(),
+                                     now_usec + uint64_t{request_body->wait_timeout_msec()} * 1000};
+    // parked: the trace ends here, the wait is not part of the handler time
+    trace.handled_usec = trace.replied_usec = now_usec;
+    if (on_parked_) {
+      on_parked_();
     }
+    return;
   }
 
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
+
+void GetEventHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetEvent)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body = {};
   service_helper.reply(*service_rpc, request,
                        hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
                        result_code, response_body);
 }
 
+// mutex_ must be held; the waiter must be erased afterwards
+void GetEventHandler::reply_waiter(Waiter &waiter, int32_t result_code,
+                                   uint32_t event_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetEvent)>();
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  response_body.event_code = event_code;
+  scratch.service_helper.reply(*waiter.service_rpc, waiter.request,
+                               hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
+                               result_code, response_body);
+}
+
+bool GetEventHandler::cancel_held_request(const std::string &client_name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = waiters_.find(client_name);
+  if (it == waiters_.end()) {
+    return false;
+  }
+  HAKO_LOG_INFO("Canceling long-poll GetEvent of client '" << client_name << "'.");
+  reply_waiter(it->second, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED,
+               static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None));
+  waiters_.erase(it);
+  return true;
+}
+
+bool GetEventHandler::push_events() {
+  const uint32_t none =
+      static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None);
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint64_t now_usec = steady_now_usec();
+  for (auto it = waiters_.begin(); it != waiters_.end();) {
+    Waiter &waiter = it->second;
+    Hako_uint32 event_code = none;
+    Hako_int32 result_code = run_get_event(waiter.asset_name, event_code);
+    if (result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK ||
+        event_code != none || now_usec >= waiter.deadline_usec) {
+      reply_waiter(waiter, result_code, event_code);
+      it = waiters_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return !waiters_.empty();
+}
+
+void GetEventHandler::release_all(int32_t result_code) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &[client_name, waiter] : waiters_) {
+    reply_waiter(waiter, result_code,
+                 static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None));
+  }
+  waiters_.clear();
+}
+
 void AckEventHandler::handle(
     ServerContext &service_context,
     std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
-    pdu::rpc::RpcRequest &request) {
-  HakoRpcServiceServerTemplateType(AckEvent) service_helper;
-  std::cout << "Handling ack_event request from client: " << request.client_name
-            << std::endl;
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(AckEvent)>();
+  auto &service_helper = scratch.service_helper;
+  HAKO_LOG_INFO("Handling ack_event request from client: " << request.client_name);
 
   Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
-  HakoCpp_AckEventRequest request_body;
+  std::optional<msgs::AckEventRequestView> request_body;
 
-  if (!validate_client_id(service_context, request.client_name, result_code)) {
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
     // Error set in helper
-  } else if (!service_helper.get_request_body(request, request_body)) {
-    std::cerr << "ERROR: Failed to get AckEvent request body." << std::endl;
+  } else if (!(request_body = request_view<msgs::AckEventRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get AckEvent request body.");
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
-  } else if (request_body.result_code !=
+  } else if (request_body->result_code() !=
              hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-    std::cerr << "ERROR: AckEvent request contains error result code: "
-              << request_body.result_code << std::endl;
+    HAKO_LOG_ERROR("AckEvent request contains error result code: " << request_body->result_code());
     result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  } else if (!validate_asset_name(*client, request_body->name(), result_code)) {
+    // Error set in helper
   }
 
   if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
-    int ret = -1;
-    auto event_code =
-        static_cast<HakoSimulationAssetEvent>(request_body.event_code);
-    auto state = hakoniwa_simevent_get_state();
-    HakoPduErrorType err = HAKO_PDU_ERR_OK;
-    std::cout << "Current simulation state: "
-              << state
-              << std::endl;
-    switch (event_code) {
-    case HakoSimulationAssetEvent::HakoSimAssetEvent_Start:
-      std::cout << "Acknowledging start event for asset '"
-                << request_body.name << "'." << std::endl;
-
-      hakoniwa_asset_load_pdu_data();//load pdu data..
-      if (post_start_cb_) {
-        err = post_start_cb_();
-        if (err != HakoPduErrorType::HAKO_PDU_ERR_OK) {
-          std::cerr << "post_start_all failed with code: " << static_cast<int>(err) << std::endl;
-          result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
-          break;
-        }
-      }
+    std::lock_guard<std::mutex> lock(lifecycle_->mutex());
+    result_code = run_ack_event(client->get_node_id(), request_body->event_code(),
+                                *lifecycle_);
+  }
+  count_result(client, result_code);
 
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
 
-      ret = hakoniwa_asset_start_feedback_ok(request_body.name.c_str());
-      if (ret == 0) {
-        std::cout << "Asset '" << request_body.name
-                  << "' start acknowledged." << std::endl;
-      }
-      else {
-        std::cerr << "ERROR: Asset '" << request_body.name
-                  << "' start feedback failed. ret = " << ret << std::endl;
-      }
-      break;
-    case HakoSimulationAssetEvent::HakoSimAssetEvent_Stop:
-      ret = hakoniwa_asset_stop_feedback_ok(request_body.name.c_str());
-      if (ret == 0) {
-        std::cout << "Asset '" << request_body.name
-                  << "' stop acknowledged." << std::endl;
-      }
-      else {
-        std::cerr << "ERROR: Asset '" << request_body.name
-                  << "' stop feedback failed. ret = " << ret << std::endl;
-      }
-      break;
-    case HakoSimulationAssetEvent::HakoSimAssetEvent_Reset:
-      ret = hakoniwa_asset_reset_feedback_ok(request_body.name.c_str());
-      if (ret == 0) {
-        std::cout << "Asset '" << request_body.name
-                  << "' reset acknowledged." << std::endl;
-      }
-      else {
-        std::cerr << "ERROR: Asset '" << request_body.name
-                  << "' reset feedback failed. ret = " << ret << std::endl;
-      }
-      break;
-    default:
-      std::cerr << "ERROR: AckEvent request contains unknown event code: "
-                << request_body.event_code << std::endl;
+void AckEventHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(AckEvent)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  service_helper.reply(*service_rpc, request,
+                       hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
+                       result_code, response_body);
+}
+
+void GetServerStatsHandler::handle(
+    ServerContext &service_context,
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetServerStats)>();
+  auto &service_helper = scratch.service_helper;
+  HAKO_LOG_DEBUG("Handling get_server_stats request from client: " << request.client_name);
+
+  Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+  std::optional<msgs::GetServerStatsRequestView> request_body;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
+    HAKO_LOG_ERROR("Client ID validation failed.");
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  } else if (!(request_body = request_view<msgs::GetServerStatsRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get GetServerStats request body.");
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  }
+
+  if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+    ServiceStats stats;
+    ServiceId id = service_id_of(request_body->service_name());
+    if (id == ServiceId::Count || !stats_provider_(id, stats)) {
+      HAKO_LOG_WARN("No stats for service '" << request_body->service_name() << "'.");
       result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
-      // Set ret to true to avoid falling into the error check below for this specific case
-      ret = true;
-      break;
+    } else {
+      response_body.service_name = stats.service_name;
+      response_body.count = stats.total.count;
+      response_body.rejected = stats.rejected;
+      response_body.queue_wait_p50_usec = stats.queue_wait.p50_usec;
+      response_body.queue_wait_p99_usec = stats.queue_wait.p99_usec;
+      response_body.queue_wait_p999_usec = stats.queue_wait.p999_usec;
+      response_body.queue_wait_max_usec = stats.queue_wait.max_usec;
+      response_body.handler_p50_usec = stats.handler.p50_usec;
+      response_body.handler_p99_usec = stats.handler.p99_usec;
+      response_body.handler_p999_usec = stats.handler.p999_usec;
+      response_body.handler_max_usec = stats.handler.max_usec;
+      response_body.reply_p50_usec = stats.reply.p50_usec;
+      response_body.reply_p99_usec = stats.reply.p99_usec;
+      response_body.reply_p999_usec = stats.reply.p999_usec;
+      response_body.reply_max_usec = stats.reply.max_usec;
+      response_body.total_p50_usec = stats.total.p50_usec;
+      response_body.total_p99_usec = stats.total.p99_usec;
+      response_body.total_p999_usec = stats.total.p999_usec;
+      response_body.total_max_usec = stats.total.max_usec;
     }
+  }
+  count_result(client, result_code);
+
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
+
+void GetServerStatsHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(GetServerStats)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  service_helper.reply(*service_rpc, request,
+                       hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
+                       result_code, response_body);
+}
+
+void BatchHandler::handle(
+    ServerContext &service_context,
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(Batch)>();
+  auto &service_helper = scratch.service_helper;
+  HAKO_LOG_DEBUG("Handling batch request from client: " << request.client_name);
+
+  Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+  std::optional<msgs::BatchRequestView> request_body;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
+    // Error set in helper
+  } else if (!(request_body = request_view<msgs::BatchRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get Batch request body.");
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  } else if (request_body->op_count() > request_body->ops().size()) {
+    HAKO_LOG_ERROR("Batch request contains too many operations: " << request_body->op_count());
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  } else if (!validate_asset_name(*client, request_body->name(), result_code)) {
+    // Error set in helper
+  }
 
-    if (ret != 0) {
-        std::cerr << "ERROR: hako_asset_*_feedback failed for event " << request_body.event_code << std::endl;
-        result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR;
+  // Sub-operations run in order; a failed one does not stop the rest, its
+  // result code is reported in its own slot.
+  if (result_code == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+    // the whole batch, so that its SimControl and AckEvent operations do not
+    // interleave with those of the SimControl and AckEvent services
+    std::lock_guard<std::mutex> lock(lifecycle_->mutex());
+    const char *message = nullptr;
+    std::optional<Hako_uint32> last_event;
+    for (Hako_uint32 i = 0; i < request_body->op_count(); i++) {
+      Hako_int32 op_result = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+      Hako_uint32 value = 0;
+      Hako_uint32 arg = request_body->args()[i];
+      switch (static_cast<ServiceId>(request_body->ops()[i])) {
+      case ServiceId::GetSimState:
+        value = static_cast<Hako_uint32>(hakoniwa_simevent_get_state());
+        fill_sim_state(*client, response_body);
+        break;
+      case ServiceId::SimControl:
+        op_result = run_sim_control(arg, &message);
+        break;
+      case ServiceId::GetEvent:
+        op_result = run_get_event(client->get_node_id(), value);
+        if (op_result == hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+          last_event = value;
+        }
+        break;
+      case ServiceId::AckEvent:
+        if (arg == kBatchArgLastEvent) {
+          if (!last_event.has_value() ||
+              static_cast<HakoSimulationAssetEvent>(*last_event) ==
+                  HakoSimulationAssetEvent::HakoSimAssetEvent_None) {
+            // nothing to acknowledge
+            break;
+          }
+          arg = *last_event;
+        }
+        op_result = run_ack_event(client->get_node_id(), arg, *lifecycle_);
+        break;
+      default:
+        HAKO_LOG_ERROR("Batch request contains unsupported operation: " << request_body->ops()[i]);
+        op_result = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+        break;
+      }
+      response_body.result_codes[i] = op_result;
+      response_body.values[i] = value;
     }
+    response_body.op_count = request_body->op_count();
   }
+  count_result(client, result_code);
 
-  HakoCpp_AckEventResponse response_body;
+  reply_traced(service_helper, *service_rpc, request, result_code,
+               response_body, trace);
+}
+
+void BatchHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(Batch)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body = {};
   service_helper.reply(*service_rpc, request,
                        hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
                        result_code, response_body);
 }
 
+void SubscribeEventsHandler::handle(
+    ServerContext &service_context,
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, RequestTrace &trace) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(SubscribeEvents)>();
+  auto &service_helper = scratch.service_helper;
+  HAKO_LOG_DEBUG("Handling subscribe_events request from client: " << request.client_name);
+
+  Hako_int32 result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK;
+  std::optional<msgs::SubscribeEventsRequestView> request_body;
+
+  ClientContext *client =
+      validate_client_id(service_context, request.client_name, result_code);
+  if (client == nullptr) {
+    // Error set in helper
+  } else if (!(request_body = request_view<msgs::SubscribeEventsRequestPacketView>(request))) {
+    HAKO_LOG_ERROR("Failed to get SubscribeEvents request body.");
+    result_code = hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID;
+  } else if (!validate_asset_name(*client, request_body->name(), result_code)) {
+    // Error set in helper
+  }
+  count_result(client, result_code);
+  if (result_code != hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+    auto &response_body = scratch.response_body;
+    response_body = {};
+    reply_traced(service_helper, *service_rpc, request, result_code,
+                 response_body, trace);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  Subscriber &subscriber = subscribers_[request.client_name];
+  if (subscriber.held) {
+    // The client gave up on the previous one; answer it so it is not leaked.
+    reply_held(subscriber, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED,
+               static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None));
+  }
+  subscriber.service_rpc = std::move(service_rpc);
+  subscriber.request = request;
+  subscriber.asset_name = client->get_node_id();
+  subscriber.held = true;
+  subscriber.held_since_usec = steady_now_usec();
+  // parked: the trace ends here, the push itself is not part of the handler time
+  trace.handled_usec = trace.replied_usec = subscriber.held_since_usec;
+  if (on_parked_) {
+    on_parked_();
+  }
+}
+
+void SubscribeEventsHandler::reply_error(
+    std::shared_ptr<pdu::rpc::RpcServicesServer> service_rpc,
+    pdu::rpc::RpcRequest &request, int32_t result_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(SubscribeEvents)>();
+  auto &service_helper = scratch.service_helper;
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  service_helper.reply(*service_rpc, request,
+                       hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
+                       result_code, response_body);
+}
+
+// mutex_ must be held
+void SubscribeEventsHandler::reply_held(Subscriber &subscriber,
+                                        int32_t result_code,
+                                        uint32_t event_code) {
+  auto &scratch = worker_scratch<HakoWorkerScratchType(SubscribeEvents)>();
+  auto &response_body = scratch.response_body;
+  response_body = {};
+  response_body.event_code = event_code;
+  scratch.service_helper.reply(*subscriber.service_rpc, subscriber.request,
+                               hakoniwa::pdu::rpc::HAKO_SERVICE_STATUS_DONE,
+                               result_code, response_body);
+  subscriber.held = false;
+  subscriber.service_rpc.reset();
+}
+
+bool SubscribeEventsHandler::cancel_held_request(const std::string &client_name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = subscribers_.find(client_name);
+  if (it == subscribers_.end() || !it->second.held) {
+    return false;
+  }
+  HAKO_LOG_INFO("Canceling event subscription of client '" << client_name << "'.");
+  reply_held(it->second, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED,
+             static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None));
+  return true;
+}
+
+bool SubscribeEventsHandler::push_events() {
+  const uint32_t none =
+      static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None);
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint64_t now_usec = steady_now_usec();
+  bool any_held = false;
+  for (auto &[client_name, subscriber] : subscribers_) {
+    if (!subscriber.held) {
+      continue;
+    }
+    Hako_uint32 event_code = none;
+    if (run_get_event(subscriber.asset_name, event_code) !=
+        hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK) {
+      reply_held(subscriber, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_ERROR, none);
+      continue;
+    }
+    if (event_code == none) {
+      subscriber.last_pushed = none;
+    } else if (event_code != subscriber.last_pushed) {
+      HAKO_LOG_INFO("Pushing event " << event_code << " to client '" << client_name << "'.");
+      subscriber.last_pushed = event_code;
+      reply_held(subscriber, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK, event_code);
+      continue;
+    }
+    if (now_usec - subscriber.held_since_usec >= keepalive_usec_) {
+      reply_held(subscriber, hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_OK, none);
+      continue;
+    }
+    any_held = true;
+  }
+  return any_held;
+}
+
+void SubscribeEventsHandler::release_all(int32_t result_code) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &[client_name, subscriber] : subscribers_) {
+    if (subscriber.held) {
+      reply_held(subscriber, result_code,
+                 static_cast<uint32_t>(HakoSimulationAssetEvent::HakoSimAssetEvent_None));
+    }
+  }
+}
+
 } // namespace hakoniwa::api
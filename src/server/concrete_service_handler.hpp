@@ -2,41 +2,173 @@
 
 #include "hakoniwa/api/iservice_handler.hpp"
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace hakoniwa::api {
 
+/*
+ * Simulation lifecycle state shared by SimControlHandler, AckEventHandler
+ * and BatchHandler. The three services have separate request queues, so
+ * with several workers they could run at the same time; mutex() serializes
+ * their lifecycle operations. Every participant acknowledges Start, but the
+ * PDU data load and post_start_cb must run once per simulation start.
+ * Hold mutex() while calling the other members.
+ */
+class SimLifecycle {
+public:
+    explicit SimLifecycle(std::function<HakoPduErrorType()> post_start_cb = {})
+        : post_start_cb_(std::move(post_start_cb)) {}
+    std::mutex& mutex() { return mutex_; }
+    // Load the PDU data and run post_start_cb, unless this run already did.
+    HakoPduErrorType prepare_start();
+    // A Stop or Reset acknowledgement ends the run; the next Start prepares again.
+    void end_run() { start_prepared_ = false; }
+
+private:
+    std::function<HakoPduErrorType()> post_start_cb_;
+    std::mutex mutex_;
+    bool start_prepared_{false}; // guarded by mutex_
+};
+
 class JoinHandler : public IServiceHandler {
 public:
     ~JoinHandler() = default;
-    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request) override;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
 };
 
 class GetSimStateHandler : public IServiceHandler {
 public:
     ~GetSimStateHandler() = default;
-    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request) override;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
+    // read-only query, safe to run on several workers at once
+    bool is_serialized() const override { return false; }
 };
 
 class SimControlHandler : public IServiceHandler {
 public:
+    explicit SimControlHandler(std::shared_ptr<SimLifecycle> lifecycle)
+        : lifecycle_(std::move(lifecycle)) {}
     ~SimControlHandler() = default;
-    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request) override;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
+private:
+    std::shared_ptr<SimLifecycle> lifecycle_;
 };
 
+/*
+ * GetEvent with wait_timeout_msec > 0 is a long poll: when there is no event
+ * yet, handle() parks the request and the event watcher thread answers it
+ * from push_events() as soon as an event occurs, or with None at the deadline.
+ */
 class GetEventHandler : public IServiceHandler {
 public:
+    // on_parked wakes the event watcher thread when a request is parked
+    explicit GetEventHandler(std::function<void()> on_parked = {})
+        : on_parked_(std::move(on_parked)) {}
     ~GetEventHandler() = default;
-    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request) override;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
+    bool cancel_held_request(const std::string& client_name) override;
+
+    // Called by the event watcher thread. Returns false once nothing is parked.
+    bool push_events();
+    // Answer every parked request with result_code (server stop).
+    void release_all(int32_t result_code);
+
+private:
+    struct Waiter {
+        std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc;
+        hakoniwa::pdu::rpc::RpcRequest request;
+        std::string asset_name;
+        uint64_t deadline_usec{0};
+    };
+    void reply_waiter(Waiter& waiter, int32_t result_code, uint32_t event_code);
+
+    std::function<void()> on_parked_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Waiter> waiters_; // by client name, guarded by mutex_
 };
 
 class AckEventHandler : public IServiceHandler {
 public:
-    explicit AckEventHandler(std::function<HakoPduErrorType()> post_start_cb = {})
-        : post_start_cb_(std::move(post_start_cb)) {}
+    explicit AckEventHandler(std::shared_ptr<SimLifecycle> lifecycle)
+        : lifecycle_(std::move(lifecycle)) {}
     ~AckEventHandler() = default;
-    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request) override;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
 private:
-    std::function<HakoPduErrorType()> post_start_cb_;
+    std::shared_ptr<SimLifecycle> lifecycle_;
+};
+
+class GetServerStatsHandler : public IServiceHandler {
+public:
+    using StatsProvider = std::function<bool(ServiceId, ServiceStats&)>;
+    explicit GetServerStatsHandler(StatsProvider stats_provider)
+        : stats_provider_(std::move(stats_provider)) {}
+    ~GetServerStatsHandler() = default;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
+    // read-only query, safe to run on several workers at once
+    bool is_serialized() const override { return false; }
+private:
+    StatsProvider stats_provider_;
+};
+
+class BatchHandler : public IServiceHandler {
+public:
+    explicit BatchHandler(std::shared_ptr<SimLifecycle> lifecycle)
+        : lifecycle_(std::move(lifecycle)) {}
+    ~BatchHandler() = default;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
+private:
+    std::shared_ptr<SimLifecycle> lifecycle_;
+};
+
+/*
+ * SubscribeEvents: handle() only parks the request. ServerCore's event
+ * watcher thread calls push_events(), which checks the asset events of the
+ * subscribed clients and answers a parked request once an event other than
+ * None shows up (each event is pushed once), or with None after
+ * keepalive_usec so that the client can re-arm or stop.
+ */
+class SubscribeEventsHandler : public IServiceHandler {
+public:
+    // on_parked wakes the event watcher thread when a request is parked
+    SubscribeEventsHandler(uint64_t keepalive_usec, std::function<void()> on_parked = {})
+        : keepalive_usec_(keepalive_usec), on_parked_(std::move(on_parked)) {}
+    ~SubscribeEventsHandler() = default;
+    void handle(ServerContext& service_context, std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc,  hakoniwa::pdu::rpc::RpcRequest& request, RequestTrace& trace) override;
+    void reply_error(std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc, hakoniwa::pdu::rpc::RpcRequest& request, int32_t result_code) override;
+    bool cancel_held_request(const std::string& client_name) override;
+    // only parks the request, safe to run on several workers at once
+    bool is_serialized() const override { return false; }
+
+    // Called by the event watcher thread. Returns false once nothing is parked.
+    bool push_events();
+    // Answer every parked request with result_code (server stop).
+    void release_all(int32_t result_code);
+
+private:
+    struct Subscriber {
+        std::shared_ptr<hakoniwa::pdu::rpc::RpcServicesServer> service_rpc;
+        hakoniwa::pdu::rpc::RpcRequest request;
+        std::string asset_name;
+        bool held{false};
+        uint64_t held_since_usec{0};
+        uint32_t last_pushed{0}; // event already pushed, until the asset reports None again
+    };
+    void reply_held(Subscriber& subscriber, int32_t result_code, uint32_t event_code);
+
+    uint64_t keepalive_usec_;
+    std::function<void()> on_parked_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, Subscriber> subscribers_; // by client name, guarded by mutex_
 };
 
 } // namespace hakoniwa::api
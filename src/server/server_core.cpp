@@ -1,9 +1,10 @@
 #include "hakoniwa/api/server_core.hpp"
+#include "hakoniwa/api/logger.hpp"
 #include "hakoniwa/pdu/rpc/rpc_services_server.hpp"
 #include "concrete_service_handler.hpp"
 #include "hakoniwa/hakoniwa_asset_polling.h"
+#include <algorithm>
 #include <fstream>
-#include <iostream>
 #include <chrono>
 #include <string>
 #include <filesystem>
@@ -67,16 +68,20 @@ bool ServerCore::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> en
             set_last_error("Config error: 'servers' does not match the provided node ID.");
             return false;
         }
-        bool client_found = false;
+        if (!config_.contains("participants") || !config_["participants"].is_array()) {
+            set_last_error("Config error: 'participants' array not found or not an array.");
+            return false;
+        }
         for (const auto& client : config_["participants"]) {
-            if (client["server_nodeId"] == node_id_) {
-                client_found = true;
-                server_context_.set_client_node_id(client["nodeId"]);
-                server_context_.set_client_name(client["name"]);
-                break;
+            if (client.value("server_nodeId", "") != node_id_) {
+                continue;
+            }
+            if (server_context_.add_client(client["nodeId"], client["name"]) == nullptr) {
+                set_last_error("Config error: Duplicate participant name '" + client["name"].get<std::string>() + "'.");
+                return false;
             }
         }
-        if (!client_found) {
+        if (server_context_.client_count() == 0) {
             set_last_error("Config error: No participant found for server node ID '" + node_id_ + "'.");
             return false;
         }
@@ -91,6 +96,80 @@ bool ServerCore::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> en
             set_last_error("Config error: 'poll_sleep_time_usec' must be greater than 0.");
             return false;
         }
+        // Check for "handler_worker_count" (optional)
+        if (config_.contains("handler_worker_count")) {
+            if (!config_["handler_worker_count"].is_number_unsigned()) {
+                set_last_error("Config error: 'handler_worker_count' is not an unsigned number.");
+                return false;
+            }
+            handler_worker_count_ = config_["handler_worker_count"].get<uint32_t>();
+            if (handler_worker_count_ == 0) {
+                set_last_error("Config error: 'handler_worker_count' must be greater than 0.");
+                return false;
+            }
+        }
+        // Check for "serve_mode" (optional)
+        if (config_.contains("serve_mode")) {
+            if (!config_["serve_mode"].is_string()) {
+                set_last_error("Config error: 'serve_mode' is not a string.");
+                return false;
+            }
+            std::string serve_mode = config_["serve_mode"];
+            if (serve_mode == "poll") {
+                serve_mode_ = ServeMode::Poll;
+            } else if (serve_mode == "adaptive") {
+                serve_mode_ = ServeMode::Adaptive;
+            } else {
+                set_last_error("Config error: Invalid 'serve_mode': " + serve_mode);
+                return false;
+            }
+        }
+        // Check for "serve_spin_budget_usec" (optional, used by "adaptive" serve mode)
+        if (config_.contains("serve_spin_budget_usec")) {
+            if (!config_["serve_spin_budget_usec"].is_number_unsigned()) {
+                set_last_error("Config error: 'serve_spin_budget_usec' is not an unsigned number.");
+                return false;
+            }
+            serve_spin_budget_usec_ = config_["serve_spin_budget_usec"].get<uint64_t>();
+        }
+        // Check for "request_queue_depth" (optional)
+        if (config_.contains("request_queue_depth")) {
+            if (!config_["request_queue_depth"].is_number_unsigned()) {
+                set_last_error("Config error: 'request_queue_depth' is not an unsigned number.");
+                return false;
+            }
+            request_queue_depth_ = config_["request_queue_depth"].get<uint32_t>();
+            if (request_queue_depth_ == 0) {
+                set_last_error("Config error: 'request_queue_depth' must be greater than 0.");
+                return false;
+            }
+        }
+        // Check for "event_watch_interval_usec" (optional, SubscribeEvents)
+        if (config_.contains("event_watch_interval_usec")) {
+            if (!config_["event_watch_interval_usec"].is_number_unsigned()) {
+                set_last_error("Config error: 'event_watch_interval_usec' is not an unsigned number.");
+                return false;
+            }
+            event_watch_interval_usec_ = config_["event_watch_interval_usec"].get<uint64_t>();
+            if (event_watch_interval_usec_ == 0) {
+                set_last_error("Config error: 'event_watch_interval_usec' must be greater than 0.");
+                return false;
+            }
+        }
+        // Check for "event_subscription_keepalive_usec" (optional, SubscribeEvents)
+        if (config_.contains("event_subscription_keepalive_usec")) {
+            if (!config_["event_subscription_keepalive_usec"].is_number_unsigned()) {
+                set_last_error("Config error: 'event_subscription_keepalive_usec' is not an unsigned number.");
+                return false;
+            }
+            event_subscription_keepalive_usec_ = config_["event_subscription_keepalive_usec"].get<uint64_t>();
+            // A client that unsubscribes cannot cancel its parked request; the
+            // keepalive is what ends it and frees the client's SubscribeEvents slot.
+            if (event_subscription_keepalive_usec_ == 0) {
+                set_last_error("Config error: 'event_subscription_keepalive_usec' must be greater than 0.");
+                return false;
+            }
+        }
         if (enable_conductor_) {
             if (conductor_delta_time_usec_ == 0 || conductor_max_delay_time_usec_ == 0) {
                 set_last_error("Conductor timing is not configured.");
@@ -100,7 +179,7 @@ bool ServerCore::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> en
                 set_last_error("Conductor timing error: max_delay_time_usec must be >= delta_time_usec.");
                 return false;
             }
-            std::cout << "Conductor mode enabled." << std::endl;
+            HAKO_LOG_INFO("Conductor mode enabled.");
             if (hakoniwa_master_init() != 0) {
                 set_last_error("Failed to initialize Hako master.");
                 return false;
@@ -134,18 +213,42 @@ bool ServerCore::initialize(std::shared_ptr<hakoniwa::pdu::EndpointContainer> en
         rpc_config_path_ = (base_path / config_["rpc_service_config_path"].get<std::string>()).string();
 
         // service handlers registration
-        handlers_["HakoRemoteApi/Join"] = std::make_unique<JoinHandler>();
-        handlers_["HakoRemoteApi/GetSimState"] = std::make_unique<GetSimStateHandler>();
-        handlers_["HakoRemoteApi/SimControl"] = std::make_unique<SimControlHandler>();
-        handlers_["HakoRemoteApi/GetEvent"] = std::make_unique<GetEventHandler>();
-        handlers_["HakoRemoteApi/AckEvent"] = std::make_unique<AckEventHandler>(
-            [this]() -> HakoPduErrorType {
-                if (!endpoint_container_) {
-                    return HAKO_PDU_ERR_INVALID_CONFIG;
-                }
-                return endpoint_container_->post_start_all();
+        auto lifecycle = std::make_shared<SimLifecycle>([this]() -> HakoPduErrorType {
+            if (!endpoint_container_) {
+                return HAKO_PDU_ERR_INVALID_CONFIG;
+            }
+            return endpoint_container_->post_start_all();
+        });
+        handlers_[to_index(ServiceId::Join)] = std::make_unique<JoinHandler>();
+        handlers_[to_index(ServiceId::GetSimState)] = std::make_unique<GetSimStateHandler>();
+        handlers_[to_index(ServiceId::SimControl)] = std::make_unique<SimControlHandler>(lifecycle);
+        auto wake_event_watcher = [this]() {
+            {
+                std::lock_guard<std::mutex> lock(event_watch_mutex_);
+                event_parked_ = true;
+            }
+            event_watch_cv_.notify_one();
+        };
+        auto get_event = std::make_unique<GetEventHandler>(wake_event_watcher);
+        get_event_handler_ = get_event.get();
+        handlers_[to_index(ServiceId::GetEvent)] = std::move(get_event);
+        handlers_[to_index(ServiceId::AckEvent)] = std::make_unique<AckEventHandler>(lifecycle);
+        handlers_[to_index(ServiceId::GetServerStats)] = std::make_unique<GetServerStatsHandler>(
+            [this](ServiceId id, ServiceStats& out) {
+                return service_stats(id, out);
             }
         );
+        handlers_[to_index(ServiceId::Batch)] = std::make_unique<BatchHandler>(lifecycle);
+        auto subscribe_events = std::make_unique<SubscribeEventsHandler>(event_subscription_keepalive_usec_,
+                                                                         wake_event_watcher);
+        subscribe_events_handler_ = subscribe_events.get();
+        handlers_[to_index(ServiceId::SubscribeEvents)] = std::move(subscribe_events);
+        for (size_t i = 0; i < kServiceCount; i++) {
+            if (handlers_[i]) {
+                request_queues_[i] = std::make_unique<ServiceRequestQueue>(
+                    static_cast<ServiceId>(i), handlers_[i].get(), request_queue_depth_);
+            }
+        }
 
     } catch (const nlohmann::json::parse_error& e) {
         set_last_error("Failed to parse configuration file: " + std::string(e.what()));
@@ -159,13 +262,31 @@ bool ServerCore::initialize_rpc_services() {
     // 2. Initialize RPC Server
     try {
         // The queue size (1000) is hardcoded for now, as in the test.
-        rpc_server_ = std::make_shared<hakoniwa::pdu::rpc::RpcServicesServer>(
-            node_id_, "RpcServerEndpointImpl", rpc_config_path_, poll_sleep_time_usec_);
-        if (!rpc_server_->initialize_services(endpoint_container_, server_context_.get_client_node_id())) {
-            set_last_error("Failed to initialize RPC services.");
-            rpc_server_.reset();
+        bool ok = true;
+        server_context_.for_each_client([&](ClientContext& client) {
+            if (!ok) {
+                return;
+            }
+            auto rpc_server = std::make_shared<hakoniwa::pdu::rpc::RpcServicesServer>(
+                node_id_, "RpcServerEndpointImpl", rpc_config_path_, poll_sleep_time_usec_);
+            if (!rpc_server->initialize_services(endpoint_container_, client.get_node_id())) {
+                set_last_error("Failed to initialize RPC services for client '" + client.get_name() + "'.");
+                ok = false;
+                return;
+            }
+            rpc_servers_.push_back(std::move(rpc_server));
+            participant_names_.push_back(client.get_name());
+        });
+        if (!ok) {
+            rpc_servers_.clear();
+            participant_names_.clear();
             return false;
         }
+        for (auto& queue : request_queues_) {
+            if (queue) {
+                queue->participants.assign(rpc_servers_.size(), {});
+            }
+        }
     } catch (const std::exception& e) {
         set_last_error("Failed to create RpcServicesServer: " + std::string(e.what()));
         return false;
@@ -185,7 +306,9 @@ bool ServerCore::start() {
         return false;
     }    
     // 3. Start services and serving thread
-    rpc_server_->start_all_services();
+    for (auto& rpc_server : rpc_servers_) {
+        rpc_server->start_all_services();
+    }
 
     stop_requested_ = false;
     is_running_ = true;
@@ -193,9 +316,13 @@ bool ServerCore::start() {
         conductor_thread_ = std::thread(&ServerCore::conductor_loop, this);
     }
     serve_thread_ = std::thread(&ServerCore::serve, this);
-    service_handle_thread_ = std::thread(&ServerCore::handle, this);
+    event_watch_thread_ = std::thread(&ServerCore::event_watch_loop, this);
+    for (uint32_t i = 0; i < handler_worker_count_; i++) {
+        service_handle_threads_.emplace_back(&ServerCore::handle, this);
+    }
 
-    std::cout << "Hakoniwa Remote API Server started." << std::endl;
+    HAKO_LOG_INFO("Hakoniwa Remote API Server started. participants: " << rpc_servers_.size()
+                  << ", handler workers: " << handler_worker_count_);
     return true;
 }
 
@@ -206,31 +333,69 @@ bool ServerCore::stop() {
         return true;
     }
 
-    std::cout << "Stopping Hakoniwa Remote API Server..." << std::endl;
-    stop_requested_ = true;
+    HAKO_LOG_INFO("Stopping Hakoniwa Remote API Server...");
+    {
+        // under handler_mutex_ so that a worker between its predicate check and wait() cannot miss it
+        std::lock_guard<std::mutex> lock(handler_mutex_);
+        stop_requested_ = true;
+    }
+    handler_cv_.notify_all();
+    serve_wakeup_.notify();
+    {
+        // the watcher checks stop_requested_ under event_watch_mutex_ before it waits
+        std::lock_guard<std::mutex> lock(event_watch_mutex_);
+    }
+    event_watch_cv_.notify_all();
 
-    std::cout << "Waiting for server threads to join..." << std::endl;
+    HAKO_LOG_INFO("Waiting for server threads to join...");
     if (serve_thread_.joinable()) {
         serve_thread_.join();
     }
-    std::cout << "Serve thread joined." << std::endl;
-    if (service_handle_thread_.joinable()) {
-        service_handle_thread_.join();
+    HAKO_LOG_INFO("Serve thread joined.");
+    for (auto& worker : service_handle_threads_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    service_handle_threads_.clear();
+    HAKO_LOG_INFO("Service handler threads joined.");
+    if (event_watch_thread_.joinable()) {
+        event_watch_thread_.join();
     }
-    std::cout << "Service handler thread joined." << std::endl;
-    if (rpc_server_) {
-        rpc_server_->stop_all_services();
+    // answer the requests still parked so that clients do not wait forever
+    get_event_handler_->release_all(hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED);
+    subscribe_events_handler_->release_all(hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED);
+    for (auto& rpc_server : rpc_servers_) {
+        rpc_server->stop_all_services();
     }
-    std::cout << "RPC services stopped." << std::endl;
+    HAKO_LOG_INFO("RPC services stopped.");
     if (enable_conductor_ && conductor_thread_.joinable()) {
         conductor_thread_.join();
     }
     
     is_running_ = false;
-    std::cout << "Hakoniwa Remote API Server stopped." << std::endl;
+    HAKO_LOG_INFO("Hakoniwa Remote API Server stopped.");
     return true;
 }
 
+// Drives SubscribeEvents and long-poll GetEvent: checks the asset events of
+// clients that have a request parked every event_watch_interval_usec_, and
+// sleeps until a handler parks one while there is none.
+void ServerCore::event_watch_loop() {
+    while (!stop_requested_) {
+        bool parked = get_event_handler_->push_events();
+        parked = subscribe_events_handler_->push_events() || parked;
+        std::unique_lock<std::mutex> lock(event_watch_mutex_);
+        if (parked) {
+            event_watch_cv_.wait_for(lock, std::chrono::microseconds(event_watch_interval_usec_),
+                                     [this] { return stop_requested_.load(); });
+        } else {
+            event_watch_cv_.wait(lock, [this] { return stop_requested_.load() || event_parked_; });
+        }
+        event_parked_ = false;
+    }
+}
+
 void ServerCore::conductor_loop() {
     while (!stop_requested_) {
         int simulation_progressed = hakoniwa_master_execute();
@@ -245,109 +410,314 @@ void ServerCore::conductor_loop() {
     }
 }
 
+ServerCore::ServiceRequestQueue* ServerCore::find_request_queue(std::string_view service_name) const {
+    ServiceId id = service_id_of(service_name);
+    if (id == ServiceId::Count) {
+        return nullptr;
+    }
+    return request_queues_[to_index(id)].get();
+}
+
+void ServerCore::enqueue_request(uint32_t server_index, hakoniwa::pdu::rpc::RpcRequest& request,
+                                 uint64_t received_usec) {
+    ServiceRequestQueue* queue = find_request_queue(request.header.service_name);
+    if (queue == nullptr) {
+        HAKO_LOG_ERROR("No handler registered for service: " << request.header.service_name);
+        return;
+    }
+    HAKO_LOG_DEBUG("New request received for service: " << request.header.service_name);
+    HAKO_LOG_DEBUG("Request ID: " << request.header.request_id
+                   << ", Client: " << request.header.client_name
+                   << ", Opcode: " << static_cast<int>(request.header.opcode));
+    // Handlers look the ClientContext up by client_name, so a participant must
+    // not be able to act as another one through its own RPC server.
+    if (request.client_name != participant_names_[server_index]) {
+        HAKO_LOG_WARN("Request for service " << queue->service_name << " names client '"
+                      << request.client_name << "', but the channel belongs to '"
+                      << participant_names_[server_index] << "'; replying INVALID.");
+        queue->handler->reply_error(rpc_servers_[server_index], request,
+                                    hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_INVALID);
+        return;
+    }
+    QueuedRequest job{server_index, received_usec, std::move(request)};
+    bool pushed = false;
+    uint64_t depth = 0;
+    {
+        // pairs with the predicate check in handle() so that the wakeup is not lost
+        std::lock_guard<std::mutex> lock(handler_mutex_);
+        pushed = queue->requests.try_push(std::move(job));
+        if (pushed) {
+            queue->participants[server_index].queued = true;
+        }
+        depth = queue->requests.size();
+    }
+    if (!pushed) {
+        // try_push() leaves the job untouched on failure.
+        queue->rejected++;
+        HAKO_LOG_WARN("Request queue full for service: " << queue->service_name << ", replying BUSY.");
+        queue->handler->reply_error(rpc_servers_[server_index], job.request,
+                                    hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_BUSY);
+        return;
+    }
+    queue->enqueued++;
+    uint64_t high_water = queue->high_water.load();
+    while (depth > high_water && !queue->high_water.compare_exchange_weak(high_water, depth)) {
+    }
+    handler_cv_.notify_one();
+}
+
+bool ServerCore::poll_once() {
+    bool has_event = false;
+    for (uint32_t i = 0; i < rpc_servers_.size(); i++) {
+        if (poll_server(i)) {
+            has_event = true;
+        }
+    }
+    return has_event;
+}
+
+bool ServerCore::poll_server(uint32_t server_index) {
+    hakoniwa::pdu::rpc::RpcRequest request;
+    auto event = rpc_servers_[server_index]->poll(request);
+
+    if (event == hakoniwa::pdu::rpc::ServerEventType::REQUEST_IN) {
+        enqueue_request(server_index, request, steady_now_usec());
+    }
+    else if (event == hakoniwa::pdu::rpc::ServerEventType::REQUEST_CANCEL)
+    {
+        std::lock_guard<std::mutex> lock(handler_mutex_);
+        ServiceRequestQueue* queue = find_request_queue(request.header.service_name);
+        if (queue == nullptr) {
+            HAKO_LOG_ERROR("No handler registered for service: " << request.header.service_name);
+        } else if (request.client_name != participant_names_[server_index]) {
+            HAKO_LOG_WARN("Cancel for service " << queue->service_name << " names client '"
+                          << request.client_name << "', but the channel belongs to '"
+                          << participant_names_[server_index] << "'; ignored.");
+        } else if (queue->handler->cancel_held_request(request.client_name)) {
+            // a parked request (long-poll GetEvent, SubscribeEvents) has been answered with CANCELED
+        } else if (queue->participants[server_index].queued || queue->participants[server_index].in_flight) {
+            // Answered CANCELED when it is dispatched, or passed to cancel_held_request()
+            // once handle() returns in case handle() parked it.
+            queue->participants[server_index].cancel_requested = true;
+        } else {
+            HAKO_LOG_WARN("No pending request to cancel for service: " << request.header.service_name);
+        }
+    }
+    else {
+        return false;
+    }
+    serve_event_count_++;
+    return true;
+}
+
 void ServerCore::serve() {
-    std::cout << "Server serving thread started." << std::endl;
+    HAKO_LOG_INFO("Server serving thread started.");
+    // adaptive mode state
+    auto idle_start = std::chrono::steady_clock::now();
+    uint64_t backoff_usec = 0;
     while (!stop_requested_) {
-        if (rpc_server_) {
-            hakoniwa::pdu::rpc::RpcRequest request;
-            auto event = rpc_server_->poll(request);
-
-            if (event == hakoniwa::pdu::rpc::ServerEventType::REQUEST_IN) {
-                bool inserted = false;
-                {
-                    std::lock_guard<std::mutex> lock(handler_mutex_);
-                    if (pending_requests_.count(request.header.service_name) == 0) {
-                        #ifdef ENABLE_DEBUG_MESSAGES
-                        std::cout << "New request received for service: "
-                                  << request.header.service_name << std::endl;
-                        std::cout << "Request ID: " << request.header.request_id
-                                  << ", Client: " << request.header.client_name
-                                  << ", Opcode: " << static_cast<int>(request.header.opcode)
-                                  << std::endl;
-                        #endif
-                        pending_requests_[request.header.service_name] = request;
-                        inserted = true;
-                    } else {
-                        std::cerr << "WARNING: Overwriting pending request for service: "
-                                  << request.header.service_name << std::endl;
-                    }
-                }
-                if (inserted) {
-                    handler_cv_.notify_one();
-                }
-            }
-            else if (event == hakoniwa::pdu::rpc::ServerEventType::REQUEST_CANCEL)
-            {
-                std::lock_guard<std::mutex> lock(handler_mutex_);
-                if (pending_requests_.count(request.header.service_name) > 0) {
-                    //TODO
-                    auto it = handlers_.find(request.header.service_name);
-                    if (it != handlers_.end()) {
-                        it->second->cancel();
-                    } else {
-                        std::cerr << "ERROR: No handler registered for service: "
-                                  << request.header.service_name << std::endl;
-                    }
+        if (rpc_servers_.empty()) {
+            time_source_->sleep_delta_time();
+            continue;
+        }
+        switch (serve_mode_) {
+        case ServeMode::Adaptive:
+            if (poll_once()) {
+                idle_start = std::chrono::steady_clock::now();
+                backoff_usec = 0;
+            } else if (std::chrono::steady_clock::now() - idle_start <
+                       std::chrono::microseconds(serve_spin_budget_usec_)) {
+                serve_spin_count_++;
+            } else {
+                backoff_usec = (backoff_usec == 0) ? 1 : std::min(backoff_usec * 2, poll_sleep_time_usec_);
+                if (backoff_usec < poll_sleep_time_usec_) {
+                    serve_backoff_count_++;
                 } else {
-                    std::cerr << "WARNING: No pending request to cancel for service: "
-                              << request.header.service_name << std::endl;
+                    serve_park_count_++;
                 }
+                serve_wakeup_.wait_for(backoff_usec);
             }
+            break;
+        case ServeMode::Poll:
+        default:
+            poll_once();
+            time_source_->sleep_delta_time();
+            break;
+        }
+    }
+    HAKO_LOG_INFO("Server serving thread exit.");
+}
+
+ServerCore::ServiceRequestQueue* ServerCore::pop_dispatchable_request(QueuedRequest& job) {
+    // round robin over services so that a flooded service cannot starve the others
+    const size_t count = request_queues_.size();
+    for (size_t i = 0; i < count; i++) {
+        size_t index = (dispatch_cursor_ + i) % count;
+        ServiceRequestQueue* queue = request_queues_[index].get();
+        if (queue == nullptr) {
+            continue;
+        }
+        if (queue->handler->is_serialized() && queue->in_flight > 0) {
+            continue;
+        }
+        if (queue->requests.try_pop(job)) {
+            dispatch_cursor_ = (index + 1) % count;
+            queue->participants[job.server_index].queued = false;
+            return queue;
         }
-        time_source_->sleep_delta_time();
     }
-    std::cout << "Server serving thread exit." << std::endl;
-    handler_cv_.notify_all(); // for stop
+    return nullptr;
 }
 
 void ServerCore::handle() {
-    std::cout << "Service handler thread started." << std::endl;
+    HAKO_LOG_INFO("Service handler thread started.");
     while (!stop_requested_) {
-        std::pair<std::string, hakoniwa::pdu::rpc::RpcRequest> job;
-        bool has_job = false;
+        QueuedRequest job;
+        ServiceRequestQueue* queue = nullptr;
+        bool canceled = false;
 
         {
             std::unique_lock<std::mutex> lock(handler_mutex_);
             handler_cv_.wait(lock, [&]{
-                return stop_requested_ || !pending_requests_.empty();
+                if (stop_requested_) {
+                    return true;
+                }
+                queue = pop_dispatchable_request(job);
+                return queue != nullptr;
             });
 
             if (stop_requested_) {
-                std::cout << "Service handler thread exit." << std::endl;
+                HAKO_LOG_INFO("Service handler thread exit.");
                 return;
             }
-
-            job = *pending_requests_.begin();
-            has_job = true;
-        }
-
-        if (has_job) {
-            const auto& service_name = job.first;
-            auto it = handlers_.find(service_name);
-            if (it != handlers_.end()) {
-                #ifdef ENABLE_DEBUG_MESSAGES
-                std::cout << "Invoking handler for service: "
-                          << service_name << std::endl;
-                #endif
-                it->second->handle(server_context_, rpc_server_, job.second);
-                {
-                    std::lock_guard<std::mutex> lock(handler_mutex_);
-                    pending_requests_.erase(service_name);
-                    #ifdef ENABLE_DEBUG_MESSAGES
-                    std::cout << "Service handler completed for service: "
-                              << service_name << std::endl;
-                    #endif
-                    if (it->second->is_canceled()) {
-                        // Reset cancellation state after handling
-                        it->second->reset_canceled();
-                    }
-                }
+            auto& slot = queue->participants[job.server_index];
+            if (slot.cancel_requested) {
+                slot.cancel_requested = false;
+                canceled = true;
             } else {
-                std::cerr << "ERROR: No handler registered for service: "
-                          << service_name << std::endl;
+                slot.in_flight = true;
+                queue->in_flight++;
             }
         }
+        if (canceled) {
+            HAKO_LOG_INFO("Request of client '" << job.request.client_name << "' for service "
+                          << queue->service_name << " was canceled before dispatch.");
+            queue->handler->reply_error(rpc_servers_[job.server_index], job.request,
+                                        hakoniwa::pdu::rpc::HAKO_SERVICE_RESULT_CODE_CANCELED);
+            continue;
+        }
+
+        RequestTrace trace;
+        trace.received_usec = job.received_usec;
+        trace.dispatched_usec = steady_now_usec();
+        HAKO_LOG_DEBUG("Invoking handler for service: " << queue->service_name);
+        queue->handler->handle(server_context_, rpc_servers_[job.server_index], job.request, trace);
+        record_trace(*queue, trace);
+        bool cancel_held = false;
+        {
+            std::lock_guard<std::mutex> lock(handler_mutex_);
+            queue->in_flight--;
+            auto& slot = queue->participants[job.server_index];
+            slot.in_flight = false;
+            cancel_held = slot.cancel_requested;
+            slot.cancel_requested = false;
+            HAKO_LOG_DEBUG("Service handler completed for service: " << queue->service_name);
+            // A serialized service may have a request waiting for this one to finish.
+            handler_cv_.notify_all();
+        }
+        if (cancel_held) {
+            // The cancel arrived while handle() ran; if handle() parked the request, answer it now.
+            queue->handler->cancel_held_request(job.request.client_name);
+        }
+    }
+}
+
+void ServerCore::record_trace(ServiceRequestQueue& queue, RequestTrace& trace) {
+    // A handler that did not stamp its reply is charged up to now.
+    uint64_t now = steady_now_usec();
+    if (trace.replied_usec == 0) {
+        trace.replied_usec = now;
+    }
+    if (trace.handled_usec == 0) {
+        trace.handled_usec = trace.replied_usec;
+    }
+    queue.queue_wait.record(trace.dispatched_usec - trace.received_usec);
+    queue.handler_time.record(trace.handled_usec - trace.dispatched_usec);
+    queue.reply_time.record(trace.replied_usec - trace.handled_usec);
+    queue.total_time.record(trace.replied_usec - trace.received_usec);
+}
+
+bool ServerCore::service_stats(ServiceId id, ServiceStats& out) const {
+    if (id >= ServiceId::Count || !request_queues_[to_index(id)]) {
+        return false;
+    }
+    const ServiceRequestQueue& queue = *request_queues_[to_index(id)];
+    out.service_name = queue.service_name;
+    out.rejected = queue.rejected.load();
+    out.queue_wait = queue.queue_wait.summary();
+    out.handler = queue.handler_time.summary();
+    out.reply = queue.reply_time.summary();
+    out.total = queue.total_time.summary();
+    return true;
+}
+
+std::vector<ServiceStats> ServerCore::stats() const {
+    std::vector<ServiceStats> stats;
+    stats.reserve(kServiceCount);
+    for (size_t i = 0; i < kServiceCount; i++) {
+        ServiceStats s;
+        if (service_stats(static_cast<ServiceId>(i), s)) {
+            stats.push_back(std::move(s));
+        }
+    }
+    return stats;
+}
+
+ServeLoopCounters ServerCore::serve_loop_counters() const {
+    ServeLoopCounters c;
+    c.events = serve_event_count_.load();
+    c.spins = serve_spin_count_.load();
+    c.backoffs = serve_backoff_count_.load();
+    c.parks = serve_park_count_.load();
+    return c;
+}
+
+std::vector<ClientCounters> ServerCore::client_counters() const {
+    std::vector<ClientCounters> counters;
+    counters.reserve(server_context_.client_count());
+    server_context_.for_each_client([&](ClientContext& client) {
+        ClientCounters c;
+        c.name = client.get_name();
+        c.node_id = client.get_node_id();
+        c.status = client.get_status();
+        c.asset_registered = client.is_asset_registered();
+        c.requests = client.get_request_count();
+        c.errors = client.get_error_count();
+        counters.push_back(std::move(c));
+    });
+    return counters;
+}
+
+std::vector<RequestQueueCounters> ServerCore::request_queue_counters() const {
+    std::vector<RequestQueueCounters> counters;
+    counters.reserve(request_queues_.size());
+    for (const auto& queue : request_queues_) {
+        if (!queue) {
+            continue;
+        }
+        RequestQueueCounters c;
+        c.service_name = queue->service_name;
+        c.capacity = queue->requests.capacity();
+        {
+            std::lock_guard<std::mutex> lock(handler_mutex_);
+            c.depth = queue->requests.size();
+        }
+        c.enqueued = queue->enqueued.load();
+        c.rejected = queue->rejected.load();
+        c.high_water = queue->high_water.load();
+        counters.push_back(std::move(c));
     }
+    return counters;
 }
 
 std::string ServerCore::last_error() const noexcept {
@@ -357,7 +727,7 @@ std::string ServerCore::last_error() const noexcept {
 
 void ServerCore::set_last_error(std::string msg) {
     std::lock_guard<std::mutex> lock(err_mutex_);
-    std::cerr << "ERROR: " << msg << std::endl;
+    HAKO_LOG_ERROR(msg);
     last_error_ = std::move(msg);
 }
 